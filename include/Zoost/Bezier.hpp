@@ -0,0 +1,114 @@
+////////////////////////////////////////////////////////////
+//
+// Zoost C++ library
+// Copyright (C) 2011-2012 Pierre-Emmanuel BRIAN (zinlibs@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#ifndef ZOOST_BEZIER_HPP
+#define ZOOST_BEZIER_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <vector>
+#include <initializer_list>
+#include <Zoost/Vector2.hpp>
+#include <Zoost/Config.hpp>
+
+namespace zin
+{
+
+class ZOOST_API Bezier
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    // Constructor
+    ////////////////////////////////////////////////////////////
+    Bezier(const Point* keyPoints, size_t count);
+
+    ////////////////////////////////////////////////////////////
+    // Constructor
+    ////////////////////////////////////////////////////////////
+    Bezier(const std::initializer_list<Point>& keyPoints);
+
+    ////////////////////////////////////////////////////////////
+    // Get the degree, one less than the key points count
+    ////////////////////////////////////////////////////////////
+    size_t getDegree() const;
+
+    ////////////////////////////////////////////////////////////
+    // Get the key points
+    ////////////////////////////////////////////////////////////
+    const std::vector<Point>& getKeyPoints() const;
+
+    ////////////////////////////////////////////////////////////
+    // Get the point at the given factor, between 0 and 1
+    ////////////////////////////////////////////////////////////
+    Point operator[](double factor) const;
+
+    ////////////////////////////////////////////////////////////
+    // Get the points at each of the given factors
+    ////////////////////////////////////////////////////////////
+    void evaluate(const double* factors, size_t count, Point* points) const;
+
+    ////////////////////////////////////////////////////////////
+    // Get points at evenly spaced factors, both ends included
+    ////////////////////////////////////////////////////////////
+    void sample(size_t count, std::vector<Point>& points) const;
+
+    ////////////////////////////////////////////////////////////
+    // Split the curve in two at the given factor
+    ////////////////////////////////////////////////////////////
+    void split(double factor, Bezier& left, Bezier& right) const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    // Degree from which the binomial weights may overflow
+    ////////////////////////////////////////////////////////////
+    static const size_t MaxHornerDegree = 512;
+
+    ////////////////////////////////////////////////////////////
+    // Compute the key points weighted by the binomial row
+    ////////////////////////////////////////////////////////////
+    void update();
+
+    ////////////////////////////////////////////////////////////
+    // Get the point at the given factor from the basis of degree N
+    ////////////////////////////////////////////////////////////
+    template <unsigned int N>
+    Point evaluate(double factor) const;
+
+    ////////////////////////////////////////////////////////////
+    // Get the point at the given factor by de Casteljau
+    ////////////////////////////////////////////////////////////
+    Point deCasteljau(double factor) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Point> m_keyPoints;
+    std::vector<Point> m_weights;
+};
+
+}
+
+#endif // ZOOST_BEZIER_HPP
@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////
+//
+// Zoost C++ library
+// Copyright (C) 2011-2012 Pierre-Emmanuel BRIAN (zinlibs@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef ZOOST_BOXTREE_HPP
+#define ZOOST_BOXTREE_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <vector>
+#include <utility>
+#include <Zoost/Vector2.hpp>
+#include <Zoost/Config.hpp>
+
+namespace zin
+{
+
+class ZOOST_API BoxTree
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    // Axis aligned box struct
+    ////////////////////////////////////////////////////////////
+    struct Box { Point min; Point max; };
+
+    ////////////////////////////////////////////////////////////
+    // Build the tree over the given boxes
+    ////////////////////////////////////////////////////////////
+    void build(const std::vector<Box>& boxes);
+
+    ////////////////////////////////////////////////////////////
+    // Update the boxes without changing the tree layout
+    ////////////////////////////////////////////////////////////
+    void refit(const std::vector<Box>& boxes);
+
+    ////////////////////////////////////////////////////////////
+    // Remove all the boxes
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    // Get the boxes count
+    ////////////////////////////////////////////////////////////
+    size_t getBoxesCount() const;
+
+    ////////////////////////////////////////////////////////////
+    // Get the box enclosing all the boxes
+    ////////////////////////////////////////////////////////////
+    Box getBounds() const;
+
+    ////////////////////////////////////////////////////////////
+    // Get the indices of the boxes overlapping the given one
+    ////////////////////////////////////////////////////////////
+    void query(const Box& box, std::vector<size_t>& indices) const;
+
+    ////////////////////////////////////////////////////////////
+    // Get the indices of the boxes containing the given point
+    ////////////////////////////////////////////////////////////
+    void query(const Point& point, std::vector<size_t>& indices) const;
+
+    ////////////////////////////////////////////////////////////
+    // Get the box nearest to the point below the given squared distance, updated,
+    // the distance function giving the squared distance to the element in a box
+    // and the boxes count being returned when none is near enough
+    ////////////////////////////////////////////////////////////
+    template <typename Distance>
+    size_t nearest(const Point& point, Distance distance, double& squaredDistance) const;
+
+    ////////////////////////////////////////////////////////////
+    // Check if two boxes overlap, borders included
+    ////////////////////////////////////////////////////////////
+    static bool intersects(const Box& box1, const Box& box2);
+
+    ////////////////////////////////////////////////////////////
+    // Get the squared distance from a box to a point, zero inside
+    ////////////////////////////////////////////////////////////
+    static double squaredDistance(const Box& box, const Point& point);
+
+    ////////////////////////////////////////////////////////////
+    // Get the box enclosing two boxes
+    ////////////////////////////////////////////////////////////
+    static Box merge(const Box& box1, const Box& box2);
+
+    ////////////////////////////////////////////////////////////
+    // Get the box enclosing a segment
+    ////////////////////////////////////////////////////////////
+    static Box bound(const Point& point1, const Point& point2);
+
+    ////////////////////////////////////////////////////////////
+    // Get the box enclosing a triangle
+    ////////////////////////////////////////////////////////////
+    static Box bound(const Point& point1, const Point& point2, const Point& point3);
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    // Node struct, a leaf when its indice is set
+    ////////////////////////////////////////////////////////////
+    struct Node { Box box; size_t left; size_t right; size_t indice; };
+
+    ////////////////////////////////////////////////////////////
+    // Build the subtree over the given range and return its root
+    ////////////////////////////////////////////////////////////
+    size_t build(const std::vector<Box>& boxes, std::vector<size_t>& indices, size_t begin, size_t end);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Node> m_nodes;
+};
+
+}
+
+#include <Zoost/BoxTree.inl>
+
+#endif // ZOOST_BOXTREE_HPP
@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////
+//
+// Zoost C++ library
+// Copyright (C) 2011-2012 Pierre-Emmanuel BRIAN (zinlibs@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+namespace zin
+{
+
+////////////////////////////////////////////////////////////
+template <typename Distance>
+size_t BoxTree::nearest(const Point& point, Distance distance, double& squaredDistance) const
+{
+    size_t count = getBoxesCount(), found = count;
+
+    if( m_nodes.empty() )
+        return found;
+
+    // Depth first, the nearest child on top, the subtrees farther than the best element being skipped
+    std::vector<std::pair<size_t, double>> stack(1, std::make_pair(size_t(0), BoxTree::squaredDistance(m_nodes[0].box, point)));
+
+    while( !stack.empty() )
+    {
+        size_t indice = stack.back().first;
+        double bound = stack.back().second;
+        stack.pop_back();
+
+        if( bound >= squaredDistance )
+            continue;
+
+        const Node& node = m_nodes[indice];
+
+        if( node.indice < count )
+        {
+            double value = distance(node.indice);
+
+            if( value < squaredDistance )
+            {
+                squaredDistance = value;
+                found = node.indice;
+            }
+        }
+
+        else
+        {
+            double left = BoxTree::squaredDistance(m_nodes[node.left].box, point),
+                   right = BoxTree::squaredDistance(m_nodes[node.right].box, point);
+
+            if( left <= right )
+            {
+                stack.push_back(std::make_pair(node.right, right));
+                stack.push_back(std::make_pair(node.left, left));
+            }
+
+            else
+            {
+                stack.push_back(std::make_pair(node.left, left));
+                stack.push_back(std::make_pair(node.right, right));
+            }
+        }
+    }
+
+    return found;
+}
+
+}
@@ -0,0 +1,164 @@
+////////////////////////////////////////////////////////////
+//
+// Zoost C++ library
+// Copyright (C) 2011-2012 Pierre-Emmanuel BRIAN (zinlibs@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#ifndef ZOOST_COLLISIONWORLD_HPP
+#define ZOOST_COLLISIONWORLD_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <vector>
+#include <unordered_map>
+#include <Zoost/Geom.hpp>
+#include <Zoost/BoxTree.hpp>
+#include <Zoost/Config.hpp>
+
+namespace zin
+{
+
+class ZOOST_API CollisionWorld
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    // Pair of geoms whose global bounds overlap
+    ////////////////////////////////////////////////////////////
+    struct Pair { Geom* geom1; Geom* geom2; };
+
+    ////////////////////////////////////////////////////////////
+    // Constructor
+    ////////////////////////////////////////////////////////////
+    CollisionWorld();
+
+    ////////////////////////////////////////////////////////////
+    // Destructor
+    ////////////////////////////////////////////////////////////
+    ~CollisionWorld();
+
+    ////////////////////////////////////////////////////////////
+    // Register a geom until removed, before its destruction
+    ////////////////////////////////////////////////////////////
+    void add(Geom& geom);
+
+    ////////////////////////////////////////////////////////////
+    // Unregister a geom, its pairs are lost at the next step
+    ////////////////////////////////////////////////////////////
+    void remove(Geom& geom);
+
+    ////////////////////////////////////////////////////////////
+    // Check if a geom is registered
+    ////////////////////////////////////////////////////////////
+    bool contains(const Geom& geom) const;
+
+    ////////////////////////////////////////////////////////////
+    // Get the registered geoms count
+    ////////////////////////////////////////////////////////////
+    size_t getGeomsCount() const;
+
+    ////////////////////////////////////////////////////////////
+    // Update the bounds of the modified geoms & the pairs
+    ////////////////////////////////////////////////////////////
+    void step();
+
+    ////////////////////////////////////////////////////////////
+    // Get all the overlapping pairs
+    ////////////////////////////////////////////////////////////
+    const std::vector<Pair>& getPairs() const;
+
+    ////////////////////////////////////////////////////////////
+    // Get the pairs which began to overlap during the last step
+    ////////////////////////////////////////////////////////////
+    const std::vector<Pair>& getNewPairs() const;
+
+    ////////////////////////////////////////////////////////////
+    // Get the pairs which stopped to overlap during the last step
+    ////////////////////////////////////////////////////////////
+    const std::vector<Pair>& getLostPairs() const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    // Registered geom, flagged by its observer hooks
+    ////////////////////////////////////////////////////////////
+    struct Body : public Geom::Observer
+    {
+        Body(CollisionWorld& world, Geom& geom, Uint32 id);
+        void onTransformUpdated();
+        void onVertexAdded();
+        void onVertexRemoved(size_t id);
+        void onVertexMoved();
+        void onErasing();
+        void onEdited(const Geom::Changes& changes);
+        CollisionWorld& world;
+        Geom&           geom;
+        Uint32          id;
+        bool            dirty;
+        bool            removed;
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Bounds of a body, split between the sweep axis & the other
+    ////////////////////////////////////////////////////////////
+    struct Entry { double min; double max; double otherMin; double otherMax; Uint32 body; };
+
+    ////////////////////////////////////////////////////////////
+    // Queue a body for the next step
+    ////////////////////////////////////////////////////////////
+    void invalidate(Body& body);
+
+    ////////////////////////////////////////////////////////////
+    // Choose the axis along which the bounds are the most spread
+    ////////////////////////////////////////////////////////////
+    void chooseAxis();
+
+    ////////////////////////////////////////////////////////////
+    // Get the pair of geoms matching a key
+    ////////////////////////////////////////////////////////////
+    Pair getPair(Uint64 key) const;
+
+    ////////////////////////////////////////////////////////////
+    // Get the key of a pair of bodies
+    ////////////////////////////////////////////////////////////
+    static Uint64 getKey(Uint32 body1, Uint32 body2);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Body*>                      m_bodies;
+    std::vector<BoxTree::Box>               m_boxes;
+    std::vector<Uint32>                     m_freeIds;
+    std::vector<Uint32>                     m_dirtyIds;
+    std::vector<Uint32>                     m_removedIds;
+    std::unordered_map<const Geom*, Uint32> m_ids;
+    std::vector<Entry>                      m_entries;
+    bool                                    m_entriesAdded;
+    bool                                    m_sweepY;
+    std::vector<Uint64>                     m_keys;
+    std::vector<Pair>                       m_pairs;
+    std::vector<Pair>                       m_newPairs;
+    std::vector<Pair>                       m_lostPairs;
+};
+
+}
+
+#endif // ZOOST_COLLISIONWORLD_HPP
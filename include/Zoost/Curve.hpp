@@ -32,6 +32,7 @@
 #include <Zoost/Vector2.hpp>
 #include <Zoost/Config.hpp>
 #include <initializer_list>
+#include <vector>
 
 namespace zin
 {
@@ -40,6 +41,17 @@ class ZOOST_API Curve : public Geom
 {
 public:
 
+    ////////////////////////////////////////////////////////////
+    // Nearest position on the curve, its length counted from the first vertex
+    ////////////////////////////////////////////////////////////
+    struct Projection
+    {
+        Point  point;
+        double distance;
+        double length;
+        double factor;
+    };
+
     ////////////////////////////////////////////////////////////
     // Default constructor
     ////////////////////////////////////////////////////////////
@@ -50,6 +62,11 @@ public:
     ////////////////////////////////////////////////////////////
     Curve(const Curve& curve);
 
+    ////////////////////////////////////////////////////////////
+    // Move constructor, the moved curve is left empty
+    ////////////////////////////////////////////////////////////
+    Curve(Curve&& curve);
+
     ////////////////////////////////////////////////////////////
     // Constructor
     ////////////////////////////////////////////////////////////
@@ -75,6 +92,11 @@ public:
     ////////////////////////////////////////////////////////////
     Curve& operator=(const Curve& curve);
 
+    ////////////////////////////////////////////////////////////
+    // Take the given curve, left empty
+    ////////////////////////////////////////////////////////////
+    Curve& operator=(Curve&& curve);
+
     ////////////////////////////////////////////////////////////
     // Get the length
     ////////////////////////////////////////////////////////////
@@ -84,6 +106,26 @@ public:
     // Interpolate a value
     ////////////////////////////////////////////////////////////
     Coords operator[](double factor) const;
+
+    ////////////////////////////////////////////////////////////
+    // Get evenly spaced points along the curve, both ends included
+    ////////////////////////////////////////////////////////////
+    void sample(size_t count, std::vector<Coords>& points) const;
+
+    ////////////////////////////////////////////////////////////
+    // Get the nearest position on the curve to a global point
+    ////////////////////////////////////////////////////////////
+    Projection project(const Point& point) const;
+
+    ////////////////////////////////////////////////////////////
+    // Get the nearest positions of several global points at once
+    ////////////////////////////////////////////////////////////
+    void project(const Point* points, size_t count, Projection* projections) const;
+
+    ////////////////////////////////////////////////////////////
+    // Clear all the points & liaisons
+    ////////////////////////////////////////////////////////////
+    virtual void clear();
     
     ////////////////////////////////////////////////////////////
     // Add a vertex
@@ -94,17 +136,51 @@ public:
     // Create a bezier curve
     ////////////////////////////////////////////////////////////
     static Curve bezier(const std::initializer_list<Point>& keyPoints, Uint32 complexity = 50);
+
+    ////////////////////////////////////////////////////////////
+    // Create a bezier curve subdivided until its liaisons are
+    // closer than the tolerance to the exact curve
+    ////////////////////////////////////////////////////////////
+    static Curve adaptiveBezier(const std::initializer_list<Point>& keyPoints, double tolerance = 0.25);
     
+protected:
+
+    ////////////////////////////////////////////////////////////
+    // Method called when a vertex is moved
+    ////////////////////////////////////////////////////////////
+    virtual void onVertexMoved(size_t indice) const;
+
+    ////////////////////////////////////////////////////////////
+    // Method called when elements are removed
+    ////////////////////////////////////////////////////////////
+    virtual void onElementsRemoved();
+
 private:    
 
     using Geom::addLiaison;
     using Geom::addFace;
     using Geom::contains;
 
+    ////////////////////////////////////////////////////////////
+    // Get the cumulative lengths of the liaisons, from the first vertex
+    ////////////////////////////////////////////////////////////
+    const std::vector<double>& getLengths() const;
+
+    ////////////////////////////////////////////////////////////
+    // Interpolate a value on a liaison, from its distance to the first vertex
+    ////////////////////////////////////////////////////////////
+    Coords interpolate(size_t indice, double distance) const;
+
+    ////////////////////////////////////////////////////////////
+    // Get the factor of the nearest point of a liaison to a local point
+    ////////////////////////////////////////////////////////////
+    double getNearestFactor(size_t indice, const Point& point) const;
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    double m_length = 0;
+    mutable std::vector<double> m_lengths;
+    mutable bool                m_lengthsUpdated = false;
 };
 
 }
@@ -0,0 +1,174 @@
+////////////////////////////////////////////////////////////
+//
+// Zoost C++ library
+// Copyright (C) 2011-2012 Pierre-Emmanuel BRIAN (zinlibs@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#ifndef ZOOST_DELAUNAY_HPP
+#define ZOOST_DELAUNAY_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <vector>
+#include <Zoost/Vector2.hpp>
+#include <Zoost/Config.hpp>
+
+namespace zin
+{
+
+class ZOOST_API Delaunay
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    // Constructor
+    ////////////////////////////////////////////////////////////
+    Delaunay();
+
+    ////////////////////////////////////////////////////////////
+    // Triangulate the points, replacing the previous triangulation
+    ////////////////////////////////////////////////////////////
+    void triangulate(const Point* points, size_t count);
+
+    ////////////////////////////////////////////////////////////
+    // Force an edge between two points, false if it crosses another forced edge
+    ////////////////////////////////////////////////////////////
+    bool constrain(size_t point1, size_t point2);
+
+    ////////////////////////////////////////////////////////////
+    // Add three point indices per triangle, all of them or the ones inside the loops of forced edges
+    ////////////////////////////////////////////////////////////
+    void getTriangles(std::vector<size_t>& triangles, bool inside = false) const;
+
+    ////////////////////////////////////////////////////////////
+    // Remove all the triangles
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    // Where a point lies in a triangle
+    ////////////////////////////////////////////////////////////
+    enum Location { Inside, OnEdge, OnVertex };
+
+    ////////////////////////////////////////////////////////////
+    // Missing neighbour or vertex
+    ////////////////////////////////////////////////////////////
+    static const Uint32 None = 0xFFFFFFFF;
+
+    ////////////////////////////////////////////////////////////
+    // Add a triangle, its neighbours to be set
+    ////////////////////////////////////////////////////////////
+    Uint32 addTriangle();
+
+    ////////////////////////////////////////////////////////////
+    // Insert a vertex, return the vertex found at its place if any
+    ////////////////////////////////////////////////////////////
+    Uint32 insert(Uint32 vertex);
+
+    ////////////////////////////////////////////////////////////
+    // Walk to the triangle containing a point
+    ////////////////////////////////////////////////////////////
+    Uint32 locate(const Point& point, Location& location, Uint32& indice);
+
+    ////////////////////////////////////////////////////////////
+    // Split a triangle in three around a vertex
+    ////////////////////////////////////////////////////////////
+    void splitTriangle(Uint32 triangle, Uint32 vertex);
+
+    ////////////////////////////////////////////////////////////
+    // Split an edge & its two triangles in four around a vertex
+    ////////////////////////////////////////////////////////////
+    void splitEdge(Uint32 triangle, Uint32 indice, Uint32 vertex);
+
+    ////////////////////////////////////////////////////////////
+    // Flip the edges around a new vertex until they are all Delaunay
+    ////////////////////////////////////////////////////////////
+    void legalize(std::vector<Uint32>& triangles);
+
+    ////////////////////////////////////////////////////////////
+    // Flip the edge facing a triangle vertex, which goes first in both
+    ////////////////////////////////////////////////////////////
+    void flip(Uint32 triangle, Uint32 indice);
+
+    ////////////////////////////////////////////////////////////
+    // Find a triangle having an edge & the indice of the vertex facing it
+    ////////////////////////////////////////////////////////////
+    bool findEdge(Uint32 vertex1, Uint32 vertex2, Uint32& triangle, Uint32& indice) const;
+
+    ////////////////////////////////////////////////////////////
+    // Force an edge from a vertex towards another, return the vertex reached
+    ////////////////////////////////////////////////////////////
+    Uint32 constrainEdge(Uint32 vertex1, Uint32 vertex2);
+
+    ////////////////////////////////////////////////////////////
+    // Set the forced flag of an edge on both of its sides
+    ////////////////////////////////////////////////////////////
+    void setConstrained(Uint32 triangle, Uint32 indice);
+
+    ////////////////////////////////////////////////////////////
+    // Point a triangle to a new neighbour instead of an old one
+    ////////////////////////////////////////////////////////////
+    void replaceNeighbour(Uint32 triangle, Uint32 oldNeighbour, Uint32 newNeighbour);
+
+    ////////////////////////////////////////////////////////////
+    // Get the indice of the edge of a triangle facing a neighbour
+    ////////////////////////////////////////////////////////////
+    Uint32 getOpposite(Uint32 triangle, Uint32 neighbour) const;
+
+    ////////////////////////////////////////////////////////////
+    // Check if a vertex lies in the circle of a triangle, or beyond the edge of a ghost one
+    ////////////////////////////////////////////////////////////
+    bool isInCircle(Uint32 triangle, Uint32 vertex) const;
+
+    ////////////////////////////////////////////////////////////
+    // Positive if the points turn counterclockwise, null if aligned
+    ////////////////////////////////////////////////////////////
+    static double orientation(const Point& point1, const Point& point2, const Point& point3);
+
+    ////////////////////////////////////////////////////////////
+    // Positive if the point lies inside the circle of a counterclockwise triangle
+    ////////////////////////////////////////////////////////////
+    static double inCircle(const Point& point1, const Point& point2, const Point& point3, const Point& point);
+
+    ////////////////////////////////////////////////////////////
+    // Get the distance along a Hilbert curve of a 16 bits position
+    ////////////////////////////////////////////////////////////
+    static Uint32 hilbert(Uint32 x, Uint32 y);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Point>  m_points;
+    std::vector<Uint32> m_aliases;
+    std::vector<Uint32> m_vertexTriangles;
+    std::vector<Uint32> m_vertices;
+    std::vector<Uint32> m_neighbours;
+    std::vector<Uint8>  m_constrained;
+    std::vector<Uint32> m_stack;
+    Uint32              m_last;
+    Uint32              m_walks;
+};
+
+}
+
+#endif // ZOOST_DELAUNAY_HPP
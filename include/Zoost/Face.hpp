@@ -44,6 +44,11 @@ struct ZOOST_API Face
     ////////////////////////////////////////////////////////////
     Triangle getTriangle();
 
+    ////////////////////////////////////////////////////////////
+    // Get indice
+    ////////////////////////////////////////////////////////////
+    size_t getIndice() const;
+
     ////////////////////////////////////////////////////////////
     // Data member
     ////////////////////////////////////////////////////////////
@@ -58,7 +63,7 @@ private:
     ////////////////////////////////////////////////////////////
     // Default constructor
     ////////////////////////////////////////////////////////////
-    Face(const Vertex& vertex1, const Vertex& vertex2, const Vertex& vertex3, const Geom& geom);
+    Face(const Vertex& vertex1, const Vertex& vertex2, const Vertex& vertex3, size_t indice, const Geom& geom);
 
     ////////////////////////////////////////////////////////////
     // Copy constructor
@@ -73,7 +78,8 @@ private:
     ////////////////////////////////////////////////////////////
     // Data member
     ////////////////////////////////////////////////////////////
-    const Geom& m_geom;
+    const Geom* m_geom;
+    size_t      m_indice;
 };
 
 }
@@ -41,6 +41,9 @@
 #include <Zoost/Vertex.hpp>
 #include <Zoost/Liaison.hpp>
 #include <Zoost/Face.hpp>
+#include <Zoost/Pool.hpp>
+#include <Zoost/BoxTree.hpp>
+#include <Zoost/SweepLine.hpp>
 #include <Zoost/Config.hpp>
 
 namespace zin
@@ -55,22 +58,69 @@ public:
     ////////////////////////////////////////////////////////////
     struct Intersection { Point result; const Liaison* l1; const Liaison* l2; };
 
+    ////////////////////////////////////////////////////////////
+    // Ways of computing the global bounds under a rotation
+    ////////////////////////////////////////////////////////////
+    enum BoundsMode
+    {
+        Hull,        // Exact, transform the cached convex hull
+        LocalBounds, // Loose, transform the local bounds corners
+        Vertices     // Exact, transform all the vertices
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Range of indices [begin, end)
+    ////////////////////////////////////////////////////////////
+    struct Range { size_t begin; size_t end; };
+
+    ////////////////////////////////////////////////////////////
+    // Elements modified during an edit, in the final numbering,
+    // with the elements counts from before the edit
+    ////////////////////////////////////////////////////////////
+    struct Changes
+    {
+        Range  vertices;
+        Range  liaisons;
+        Range  faces;
+        size_t verticesCount;
+        size_t liaisonsCount;
+        size_t facesCount;
+    };
+
     ////////////////////////////////////////////////////////////
     // Geom observer class
     ////////////////////////////////////////////////////////////
     class Observer
     {
+    public:
+        virtual ~Observer() {}
+    private:
         virtual void onTransformUpdated() {}
         virtual void onVertexAdded() {}
         virtual void onLiaisonAdded() {}
         virtual void onFaceAdded() {}
-        virtual void onVertexRemoved(size_t id) {}
-        virtual void onLiaisonRemoved(size_t id) {}
-        virtual void onFaceRemoved(size_t id) {}
+        virtual void onVertexRemoved(size_t) {}
+        virtual void onLiaisonRemoved(size_t) {}
+        virtual void onFaceRemoved(size_t) {}
         virtual void onVertexMoved() {}
         virtual void onErasing() {}
+        virtual void onEdited(const Changes&) {}
         friend class Geom;
     };
+
+    ////////////////////////////////////////////////////////////
+    // Edit lasting as long as the guard
+    ////////////////////////////////////////////////////////////
+    class Edit
+    {
+    public:
+        Edit(Geom& geom);
+        ~Edit();
+    private:
+        Edit(const Edit&);
+        Edit& operator=(const Edit&);
+        Geom& m_geom;
+    };
     
 public:
     
@@ -84,6 +134,11 @@ public:
     ////////////////////////////////////////////////////////////
     Geom(const Geom& geom);
 
+    ////////////////////////////////////////////////////////////
+    // Move constructor, the moved geom is left empty
+    ////////////////////////////////////////////////////////////
+    Geom(Geom&& geom);
+
     ////////////////////////////////////////////////////////////
     // Destructor
     ////////////////////////////////////////////////////////////
@@ -99,6 +154,22 @@ public:
     ////////////////////////////////////////////////////////////
     void removeObserver(Observer& observer);
 
+    ////////////////////////////////////////////////////////////
+    // Start an edit, the observers are only told of the changes
+    // at once by onEdited when the outermost edit ends
+    ////////////////////////////////////////////////////////////
+    void beginEdit();
+
+    ////////////////////////////////////////////////////////////
+    // End an edit
+    ////////////////////////////////////////////////////////////
+    void endEdit();
+
+    ////////////////////////////////////////////////////////////
+    // Check if an edit is running
+    ////////////////////////////////////////////////////////////
+    bool isEditing() const;
+
     ////////////////////////////////////////////////////////////
     // Clear all the points, liaisons & faces
     ////////////////////////////////////////////////////////////
@@ -124,6 +195,11 @@ public:
     ////////////////////////////////////////////////////////////
     virtual Geom& operator=(const Geom& geom);
 
+    ////////////////////////////////////////////////////////////
+    // Take the geometry of the given one, left empty
+    ////////////////////////////////////////////////////////////
+    virtual Geom& operator=(Geom&& geom);
+
     ////////////////////////////////////////////////////////////
     // Add a point to the geom and return its identifier
     ////////////////////////////////////////////////////////////
@@ -154,6 +230,33 @@ public:
     ////////////////////////////////////////////////////////////
     virtual void removeFace(const Face& face);
 
+    ////////////////////////////////////////////////////////////
+    // Remove several vertices, with their liaisons and faces, in one pass
+    ////////////////////////////////////////////////////////////
+    void removeVertices(const std::vector<size_t>& indices);
+
+    ////////////////////////////////////////////////////////////
+    // Remove the vertices in the range [begin, end) in one pass
+    ////////////////////////////////////////////////////////////
+    void removeVertices(size_t begin, size_t end);
+
+    ////////////////////////////////////////////////////////////
+    // Remove several liaisons in one pass
+    ////////////////////////////////////////////////////////////
+    void removeLiaisons(const std::vector<size_t>& indices);
+
+    ////////////////////////////////////////////////////////////
+    // Remove several faces in one pass
+    ////////////////////////////////////////////////////////////
+    void removeFaces(const std::vector<size_t>& indices);
+
+    ////////////////////////////////////////////////////////////
+    // Replace the faces by a Delaunay triangulation forced along the liaisons,
+    // only keeping the faces inside the loops of liaisons when there are some,
+    // false with the faces untouched if a liaison crosses another
+    ////////////////////////////////////////////////////////////
+    bool triangulate(bool inside = true);
+
     ////////////////////////////////////////////////////////////
     // Get the vertex matching to the indice
     ////////////////////////////////////////////////////////////
@@ -174,6 +277,11 @@ public:
     ////////////////////////////////////////////////////////////
     size_t getVerticesCount() const;
 
+    ////////////////////////////////////////////////////////////
+    // Get the coordinates of all the vertices, in global space
+    ////////////////////////////////////////////////////////////
+    void getGlobalCoords(std::vector<Coords>& coords) const;
+
     ////////////////////////////////////////////////////////////
     // Get the liaisons count
     ////////////////////////////////////////////////////////////
@@ -203,6 +311,21 @@ public:
     // Get the bounds of the geom
     ////////////////////////////////////////////////////////////
     Rect getGlobalBounds() const;
+
+    ////////////////////////////////////////////////////////////
+    // Set the way of computing the global bounds
+    ////////////////////////////////////////////////////////////
+    void setBoundsMode(BoundsMode mode);
+
+    ////////////////////////////////////////////////////////////
+    // Get the way of computing the global bounds
+    ////////////////////////////////////////////////////////////
+    BoundsMode getBoundsMode() const;
+
+    ////////////////////////////////////////////////////////////
+    // Get the convex hull of the vertices, counterclockwise
+    ////////////////////////////////////////////////////////////
+    const std::vector<Point>& getHull() const;
     
     ////////////////////////////////////////////////////////////
     // Check if the given geom is intersecting the current one
@@ -213,6 +336,21 @@ public:
     // Check if the geom is intersecting the given one
     ////////////////////////////////////////////////////////////
     bool intersects(const Geom& geom, std::vector<Intersection>& intersections);
+
+    ////////////////////////////////////////////////////////////
+    // Check if the given geoms are intersecting each other
+    ////////////////////////////////////////////////////////////
+    static bool intersects(const std::vector<const Geom*>& geoms, std::vector<Intersection>& intersections);
+
+    ////////////////////////////////////////////////////////////
+    // Check if two liaisons of the geom are intersecting, adjacent ones when they overlap
+    ////////////////////////////////////////////////////////////
+    bool selfIntersects() const;
+
+    ////////////////////////////////////////////////////////////
+    // Check if two liaisons of the geom are intersecting, adjacent ones when they overlap
+    ////////////////////////////////////////////////////////////
+    bool selfIntersects(std::vector<Intersection>& intersections) const;
     
     ////////////////////////////////////////////////////////////
     // Check if the given point is contained by the geom
@@ -224,6 +362,16 @@ public:
     ////////////////////////////////////////////////////////////
     bool contains(Point point, std::vector<Face*>& faces);
 
+    ////////////////////////////////////////////////////////////
+    // Check which of the given points are contained by the geom
+    ////////////////////////////////////////////////////////////
+    size_t contains(const std::vector<Point>& points, std::vector<bool>& results);
+
+    ////////////////////////////////////////////////////////////
+    // Get the first face containing each of the given points
+    ////////////////////////////////////////////////////////////
+    size_t contains(const std::vector<Point>& points, std::vector<Face*>& faces);
+
     ////////////////////////////////////////////////////////////
     // Get a segment geom
     ////////////////////////////////////////////////////////////
@@ -278,6 +426,21 @@ public:
     // Get a polygon geom
     ////////////////////////////////////////////////////////////
     static Geom polygon(const std::initializer_list<Point>& points);
+
+    ////////////////////////////////////////////////////////////
+    // Get a polygon geom
+    ////////////////////////////////////////////////////////////
+    static Geom polygon(const std::vector<Point>& points);
+
+    ////////////////////////////////////////////////////////////
+    // Get a polygon geom
+    ////////////////////////////////////////////////////////////
+    static Geom polygon(const Point* points, size_t count);
+
+    ////////////////////////////////////////////////////////////
+    // Get a polygon geom with holes, the first contour being the outer one
+    ////////////////////////////////////////////////////////////
+    static Geom polygon(const std::vector<std::vector<Point>>& contours);
     
 protected:
 
@@ -291,19 +454,82 @@ protected:
     ////////////////////////////////////////////////////////////
     // Method called when a vertex is moved
     ////////////////////////////////////////////////////////////
-    void onVertexMoved() const;
+    virtual void onVertexMoved(size_t indice) const;
+
+    ////////////////////////////////////////////////////////////
+    // Method called when elements are removed
+    ////////////////////////////////////////////////////////////
+    virtual void onElementsRemoved();
+
+    ////////////////////////////////////////////////////////////
+    // Add indices to a range of changes
+    ////////////////////////////////////////////////////////////
+    static void extend(Range& range, size_t begin, size_t end);
+
+    ////////////////////////////////////////////////////////////
+    // Get the tree of the liaisons local boxes
+    ////////////////////////////////////////////////////////////
+    const BoxTree& getLiaisonTree() const;
+
+    ////////////////////////////////////////////////////////////
+    // Get the tree of the faces local boxes
+    ////////////////////////////////////////////////////////////
+    const BoxTree& getFaceTree() const;
+
+    ////////////////////////////////////////////////////////////
+    // Get the local box enclosing a global segment and its margin
+    ////////////////////////////////////////////////////////////
+    BoxTree::Box getLocalBox(const Segment& segment, double margin) const;
+
+    ////////////////////////////////////////////////////////////
+    // Compute the convex hull of the vertices
+    ////////////////////////////////////////////////////////////
+    void computeHull() const;
+
+    ////////////////////////////////////////////////////////////
+    // Exchange the elements with another geom, the transforms aside
+    ////////////////////////////////////////////////////////////
+    void swapElements(Geom& geom);
+
+    ////////////////////////////////////////////////////////////
+    // Remove the marked elements, and the ones using a marked vertex
+    ////////////////////////////////////////////////////////////
+    void removeElements(const std::vector<bool>& vertices, std::vector<bool>& liaisons, std::vector<bool>& faces);
+
+    ////////////////////////////////////////////////////////////
+    // Release the marked elements and pack the others, in order
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    static size_t compact(std::vector<T*>& elements, Pool<T>& pool, const std::vector<bool>& removed);
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
     mutable bool                  m_localBoundsUpdated = true;
     mutable bool                  m_globalBoundsUpdated = true;
+    mutable bool                  m_liaisonTreeUpdated = false;
+    mutable bool                  m_liaisonTreeFitted = false;
+    mutable bool                  m_faceTreeUpdated = false;
+    mutable bool                  m_faceTreeFitted = false;
+    mutable bool                  m_hullUpdated = false;
+    BoundsMode                    m_boundsMode = Hull;
     mutable Rect                  m_localBounds;
+    mutable BoxTree::Box          m_localBox;
     mutable Rect                  m_globalBounds;                            
+    mutable std::vector<double>   m_coordsX;
+    mutable std::vector<double>   m_coordsY;
     mutable std::vector<Vertex*>  m_vertices;
     mutable std::vector<Face*>    m_faces;
     mutable std::vector<Liaison*> m_liaisons;
+    mutable BoxTree               m_liaisonTree;
+    mutable BoxTree               m_faceTree;
+    mutable std::vector<Point>    m_hull;
+    Pool<Vertex>                  m_vertexPool;
+    Pool<Liaison>                 m_liaisonPool;
+    Pool<Face>                    m_facePool;
     std::set<Observer*>           m_observers;
+    mutable size_t                m_editDepth = 0;
+    mutable Changes               m_changes;
 };
 
 }
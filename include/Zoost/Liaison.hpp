@@ -44,6 +44,16 @@ struct ZOOST_API Liaison
     ////////////////////////////////////////////////////////////
     Segment getSegment();
 
+    ////////////////////////////////////////////////////////////
+    // Get indice
+    ////////////////////////////////////////////////////////////
+    size_t getIndice() const;
+
+    ////////////////////////////////////////////////////////////
+    // Get the geom owning the liaison
+    ////////////////////////////////////////////////////////////
+    const Geom& getGeom() const;
+
     ////////////////////////////////////////////////////////////
     // Data member
     ////////////////////////////////////////////////////////////  
@@ -57,7 +67,7 @@ private:
     ////////////////////////////////////////////////////////////
     // Default constructor
     ////////////////////////////////////////////////////////////
-    Liaison(const Vertex& vertex1, const Vertex& vertex2, const Geom& geom);
+    Liaison(const Vertex& vertex1, const Vertex& vertex2, size_t indice, const Geom& geom);
 
     ////////////////////////////////////////////////////////////
     // Copy constructor
@@ -72,7 +82,8 @@ private:
     ////////////////////////////////////////////////////////////
     // Data member
     ////////////////////////////////////////////////////////////
-    const Geom& m_geom;
+    const Geom* m_geom;
+    size_t      m_indice;
 };
 
 }
@@ -39,14 +39,14 @@ namespace Math
 {
 
 ////////////////////////////////////////////////////////////
-// Get the factorial of the given integer
+// Get the factorial of the given integer, up to 20
 ////////////////////////////////////////////////////////////
-unsigned int ZOOST_API fact(unsigned int n);
+Uint64 ZOOST_API fact(unsigned int n);
 
 ////////////////////////////////////////////////////////////
 // Get the binomial coefficient according to n and k
 ////////////////////////////////////////////////////////////
-unsigned int ZOOST_API binCoef(unsigned int n, unsigned int k);
+Uint64 ZOOST_API binCoef(unsigned int n, unsigned int k);
 
 ////////////////////////////////////////////////////////////
 // Get the Bernstein result 
@@ -83,6 +83,91 @@ T ZOOST_API interpolate(const T& value1, const T& value2, double t)
 	return static_cast<T>(value1 + (value2 - value1) * t);
 }
 
+////////////////////////////////////////////////////////////
+// Get the value raised to the given integer power
+////////////////////////////////////////////////////////////
+template <typename T>
+constexpr T power(T value, unsigned int n)
+{
+    return n == 0 ? T(1) : value * power(value, n - 1);
+}
+
+////////////////////////////////////////////////////////////
+// Get the binomial coefficient according to n and k at compile time,
+// exact in Uint64 up to n = 62
+////////////////////////////////////////////////////////////
+template <typename T>
+constexpr T binomial(unsigned int n, unsigned int k)
+{
+    return k > n ? T(0) : k == 0 ? T(1) : binomial<T>(n - 1, k - 1) * T(n) / T(k);
+}
+
+////////////////////////////////////////////////////////////
+// Sequence of indices, used to expand the compile time tables
+////////////////////////////////////////////////////////////
+template <unsigned int... I>
+struct Indices {};
+
+////////////////////////////////////////////////////////////
+// Build the sequence of indices from 0 to N - 1
+////////////////////////////////////////////////////////////
+template <unsigned int N, unsigned int... I>
+struct MakeIndices : MakeIndices<N - 1, N - 1, I...> {};
+
+template <unsigned int... I>
+struct MakeIndices<0, I...>
+{
+    typedef Indices<I...> Type;
+};
+
+////////////////////////////////////////////////////////////
+// Row N of the binomial coefficients, computed at compile time
+////////////////////////////////////////////////////////////
+template <typename T, unsigned int N, typename I = typename MakeIndices<N + 1>::Type>
+struct BinomialRow;
+
+template <typename T, unsigned int N, unsigned int... I>
+struct BinomialRow<T, N, Indices<I...>>
+{
+    static constexpr T values[N + 1] = {binomial<T>(N, I)...};
+};
+
+template <typename T, unsigned int N, unsigned int... I>
+constexpr T BinomialRow<T, N, Indices<I...>>::values[N + 1];
+
+////////////////////////////////////////////////////////////
+// Get the Bernstein basis polynomial k of degree N
+////////////////////////////////////////////////////////////
+template <unsigned int N>
+constexpr double bernstein(unsigned int k, double t)
+{
+    return k > N ? 0 : BinomialRow<double, N>::values[k] * power(t, k) * power(1 - t, N - k);
+}
+
+////////////////////////////////////////////////////////////
+// Get the N + 1 Bernstein basis polynomials of degree N at once
+////////////////////////////////////////////////////////////
+template <unsigned int N>
+void bernsteins(double t, double* basis)
+{
+    // Ascending powers of t first, then the descending powers of 1 - t
+    double factor = 1;
+
+    for( unsigned int k(0); k <= N; k++ )
+    {
+        basis[k] = BinomialRow<double, N>::values[k] * factor;
+        factor*=t;
+    }
+
+    factor = 1;
+
+    for( unsigned int k(N + 1); k-- > 0; )
+    {
+        basis[k]*=factor;
+        factor*=1 - t;
+    }
+}
+
 }
 
 }
@@ -0,0 +1,114 @@
+////////////////////////////////////////////////////////////
+//
+// Zoost C++ library
+// Copyright (C) 2011-2012 Pierre-Emmanuel BRIAN (zinlibs@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef ZOOST_POOL_HPP
+#define ZOOST_POOL_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+#include <new>
+#include <Zoost/Config.hpp>
+
+namespace zin
+{
+
+template <typename T>
+class Pool
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    // Default constructor
+    ////////////////////////////////////////////////////////////
+    Pool();
+
+    ////////////////////////////////////////////////////////////
+    // Destructor
+    ////////////////////////////////////////////////////////////
+    ~Pool();
+
+    ////////////////////////////////////////////////////////////
+    // Get an uninitialized slot for an element
+    ////////////////////////////////////////////////////////////
+    void* allocate();
+
+    ////////////////////////////////////////////////////////////
+    // Give back the slot of a destroyed element
+    ////////////////////////////////////////////////////////////
+    void release(void* element);
+
+    ////////////////////////////////////////////////////////////
+    // Give back all the slots at once, keeping the memory
+    ////////////////////////////////////////////////////////////
+    void reset();
+
+    ////////////////////////////////////////////////////////////
+    // Exchange the slots with another pool
+    ////////////////////////////////////////////////////////////
+    void swap(Pool& pool);
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    // Copy constructor
+    ////////////////////////////////////////////////////////////
+    Pool(const Pool&);
+
+    ////////////////////////////////////////////////////////////
+    // Assignment operator
+    ////////////////////////////////////////////////////////////
+    Pool& operator=(const Pool&);
+
+    ////////////////////////////////////////////////////////////
+    // Slot type, either an element or a link to the next free slot
+    ////////////////////////////////////////////////////////////
+    union Slot
+    {
+        Slot* next;
+        typename std::aligned_storage<sizeof(T), std::alignment_of<T>::value>::type storage;
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Chunk of contiguous slots
+    ////////////////////////////////////////////////////////////
+    struct Chunk { Slot* slots; size_t size; };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Chunk> m_chunks;
+    size_t             m_chunk = 0;
+    size_t             m_used = 0;
+    Slot*              m_free = nullptr;
+};
+
+}
+
+#include <Zoost/Pool.inl>
+
+#endif // ZOOST_POOL_HPP
@@ -0,0 +1,95 @@
+////////////////////////////////////////////////////////////
+//
+// Zoost C++ library
+// Copyright (C) 2011-2012 Pierre-Emmanuel BRIAN (zinlibs@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+namespace zin
+{
+
+////////////////////////////////////////////////////////////
+template <typename T>
+Pool<T>::Pool() {}
+
+////////////////////////////////////////////////////////////
+template <typename T>
+Pool<T>::~Pool()
+{
+    for( auto& chunk : m_chunks )
+        delete[] chunk.slots;
+}
+
+////////////////////////////////////////////////////////////
+template <typename T>
+void* Pool<T>::allocate()
+{
+    if( m_free )
+    {
+        Slot* slot = m_free;
+        m_free = slot->next;
+
+        return slot;
+    }
+
+    while( m_chunk < m_chunks.size() && m_used == m_chunks[m_chunk].size )
+    {
+        m_chunk++;
+        m_used = 0;
+    }
+
+    if( m_chunk == m_chunks.size() )
+    {
+        size_t size = m_chunks.empty() ? 16 : std::min<size_t>(m_chunks.back().size * 2, 4096);
+        m_chunks.push_back(Chunk{new Slot[size], size});
+    }
+
+    return &m_chunks[m_chunk].slots[m_used++];
+}
+
+////////////////////////////////////////////////////////////
+template <typename T>
+void Pool<T>::release(void* element)
+{
+    Slot* slot = static_cast<Slot*>(element);
+    slot->next = m_free;
+    m_free = slot;
+}
+
+////////////////////////////////////////////////////////////
+template <typename T>
+void Pool<T>::reset()
+{
+    m_chunk = 0;
+    m_used = 0;
+    m_free = nullptr;
+}
+
+////////////////////////////////////////////////////////////
+template <typename T>
+void Pool<T>::swap(Pool& pool)
+{
+    m_chunks.swap(pool.m_chunks);
+    std::swap(m_chunk, pool.m_chunk);
+    std::swap(m_used, pool.m_used);
+    std::swap(m_free, pool.m_free);
+}
+
+}
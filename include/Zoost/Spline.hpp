@@ -0,0 +1,147 @@
+////////////////////////////////////////////////////////////
+//
+// Zoost C++ library
+// Copyright (C) 2011-2012 Pierre-Emmanuel BRIAN (zinlibs@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#ifndef ZOOST_SPLINE_HPP
+#define ZOOST_SPLINE_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <vector>
+#include <initializer_list>
+#include <Zoost/Curve.hpp>
+#include <Zoost/Config.hpp>
+
+namespace zin
+{
+
+class ZOOST_API Spline : public Curve
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    // Spline types, both cubic and uniform
+    ////////////////////////////////////////////////////////////
+    enum Type { CatmullRom, BSpline };
+
+    ////////////////////////////////////////////////////////////
+    // Constructor, the complexity being the liaisons count per span
+    ////////////////////////////////////////////////////////////
+    Spline(Type type = CatmullRom, Uint32 complexity = 16);
+
+    ////////////////////////////////////////////////////////////
+    // Constructor
+    ////////////////////////////////////////////////////////////
+    Spline(Type type, const std::initializer_list<Point>& keyPoints, Uint32 complexity = 16);
+
+    ////////////////////////////////////////////////////////////
+    // Move constructor, the moved spline is left empty
+    ////////////////////////////////////////////////////////////
+    Spline(Spline&& spline);
+
+    ////////////////////////////////////////////////////////////
+    // Copy constructor
+    ////////////////////////////////////////////////////////////
+    Spline(const Spline& spline);
+
+    ////////////////////////////////////////////////////////////
+    // Replace the current spline by the given one
+    ////////////////////////////////////////////////////////////
+    Spline& operator=(const Spline& spline);
+
+    ////////////////////////////////////////////////////////////
+    // Take the given spline, left empty
+    ////////////////////////////////////////////////////////////
+    Spline& operator=(Spline&& spline);
+
+    ////////////////////////////////////////////////////////////
+    // Get the type
+    ////////////////////////////////////////////////////////////
+    Type getType() const;
+
+    ////////////////////////////////////////////////////////////
+    // Get the liaisons count per span
+    ////////////////////////////////////////////////////////////
+    Uint32 getComplexity() const;
+
+    ////////////////////////////////////////////////////////////
+    // Append a key point, only the last span is tessellated again
+    ////////////////////////////////////////////////////////////
+    void addKeyPoint(const Point& point);
+
+    ////////////////////////////////////////////////////////////
+    // Append several key points at once
+    ////////////////////////////////////////////////////////////
+    void addKeyPoints(const Point* points, size_t count);
+
+    ////////////////////////////////////////////////////////////
+    // Move a key point, only the spans it supports are tessellated again
+    ////////////////////////////////////////////////////////////
+    void setKeyPoint(size_t indice, const Point& point);
+
+    ////////////////////////////////////////////////////////////
+    // Get a key point
+    ////////////////////////////////////////////////////////////
+    const Point& getKeyPoint(size_t indice) const;
+
+    ////////////////////////////////////////////////////////////
+    // Get the key points count
+    ////////////////////////////////////////////////////////////
+    size_t getKeyPointsCount() const;
+
+    ////////////////////////////////////////////////////////////
+    // Clear the key points, the vertices & liaisons
+    ////////////////////////////////////////////////////////////
+    virtual void clear();
+
+private:
+
+    using Curve::addVertex;
+    using Curve::add;
+
+    ////////////////////////////////////////////////////////////
+    // Get a control point, the ones past the ends being mirrored
+    ////////////////////////////////////////////////////////////
+    Point getControlPoint(long indice) const;
+
+    ////////////////////////////////////////////////////////////
+    // Get the point of a span at the given factor
+    ////////////////////////////////////////////////////////////
+    Point getSpanPoint(size_t span, double factor) const;
+
+    ////////////////////////////////////////////////////////////
+    // Tessellate again the existing spans of the range
+    ////////////////////////////////////////////////////////////
+    void updateSpans(size_t begin, size_t end);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Type               m_type;
+    Uint32             m_complexity;
+    std::vector<Point> m_keyPoints;
+};
+
+}
+
+#endif // ZOOST_SPLINE_HPP
@@ -0,0 +1,110 @@
+////////////////////////////////////////////////////////////
+//
+// Zoost C++ library
+// Copyright (C) 2011-2012 Pierre-Emmanuel BRIAN (zinlibs@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef ZOOST_SWEEPLINE_HPP
+#define ZOOST_SWEEPLINE_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <vector>
+#include <map>
+#include <set>
+#include <Zoost/Vector2.hpp>
+#include <Zoost/Segment.hpp>
+#include <Zoost/Config.hpp>
+
+namespace zin
+{
+
+class ZOOST_API SweepLine
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    // Crossing struct, holding the indices of the two segments
+    ////////////////////////////////////////////////////////////
+    struct Crossing { Point result; size_t segment1; size_t segment2; };
+
+    ////////////////////////////////////////////////////////////
+    // Constructor
+    ////////////////////////////////////////////////////////////
+    SweepLine(const std::vector<Segment>& segments);
+
+    ////////////////////////////////////////////////////////////
+    // Report every crossing among the segments
+    ////////////////////////////////////////////////////////////
+    void compute(std::vector<Crossing>& crossings);
+
+    ////////////////////////////////////////////////////////////
+    // Report every crossing among the given segments
+    ////////////////////////////////////////////////////////////
+    static void compute(const std::vector<Segment>& segments, std::vector<Crossing>& crossings);
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    // Events order, from left to right then from bottom to top
+    ////////////////////////////////////////////////////////////
+    struct EventLess { bool operator()(const Point& point1, const Point& point2) const; };
+
+    ////////////////////////////////////////////////////////////
+    // Status order, from bottom to top along the sweep line
+    ////////////////////////////////////////////////////////////
+    struct StatusLess { const SweepLine* sweep; bool operator()(size_t segment1, size_t segment2) const; };
+
+    ////////////////////////////////////////////////////////////
+    // Get the height of a segment on the sweep line
+    ////////////////////////////////////////////////////////////
+    double getHeight(size_t segment) const;
+
+    ////////////////////////////////////////////////////////////
+    // Get the slope of a segment
+    ////////////////////////////////////////////////////////////
+    double getSlope(size_t segment) const;
+
+    ////////////////////////////////////////////////////////////
+    // Process the event at the given point
+    ////////////////////////////////////////////////////////////
+    void handle(const Point& point, const std::vector<size_t>& starts, std::vector<Crossing>& crossings);
+
+    ////////////////////////////////////////////////////////////
+    // Queue the crossing of two segments if it is ahead of the sweep
+    ////////////////////////////////////////////////////////////
+    void schedule(size_t segment1, size_t segment2, const Point& point);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Segment>                              m_segments;
+    std::map<Point, std::vector<size_t>, EventLess>   m_events;
+    std::set<size_t, StatusLess>                      m_status;
+    Point                                             m_sweep;
+    double                                            m_probe;
+    double                                            m_epsilon;
+};
+
+}
+
+#endif // ZOOST_SWEEPLINE_HPP
@@ -0,0 +1,201 @@
+////////////////////////////////////////////////////////////
+//
+// Zoost C++ library
+// Copyright (C) 2011-2012 Pierre-Emmanuel BRIAN (zinlibs@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#ifndef ZOOST_TOPOLOGY_HPP
+#define ZOOST_TOPOLOGY_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <vector>
+#include <Zoost/Geom.hpp>
+#include <Zoost/Config.hpp>
+
+namespace zin
+{
+
+class ZOOST_API Topology
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    // Read-only view on a list of indices
+    ////////////////////////////////////////////////////////////
+    struct Indices
+    {
+        const size_t* begin() const { return first; }
+        const size_t* end() const { return last; }
+        size_t size() const { return last - first; }
+        bool empty() const { return first == last; }
+        size_t operator[](size_t k) const { return first[k]; }
+        const size_t* first;
+        const size_t* last;
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Constructor, the geom must outlive the topology
+    ////////////////////////////////////////////////////////////
+    Topology(Geom& geom);
+
+    ////////////////////////////////////////////////////////////
+    // Destructor
+    ////////////////////////////////////////////////////////////
+    ~Topology();
+
+    ////////////////////////////////////////////////////////////
+    // Get the geom described by the topology
+    ////////////////////////////////////////////////////////////
+    const Geom& getGeom() const;
+
+    ////////////////////////////////////////////////////////////
+    // Get the vertices linked to a vertex by a liaison or a face edge
+    ////////////////////////////////////////////////////////////
+    Indices getNeighbours(size_t vertex) const;
+
+    ////////////////////////////////////////////////////////////
+    // Get the liaisons using a vertex
+    ////////////////////////////////////////////////////////////
+    Indices getLiaisons(size_t vertex) const;
+
+    ////////////////////////////////////////////////////////////
+    // Get the faces using a vertex
+    ////////////////////////////////////////////////////////////
+    Indices getFaces(size_t vertex) const;
+
+    ////////////////////////////////////////////////////////////
+    // Get the faces sharing the edge between two vertices
+    ////////////////////////////////////////////////////////////
+    void getFaces(size_t vertex1, size_t vertex2, std::vector<size_t>& faces) const;
+
+    ////////////////////////////////////////////////////////////
+    // Get the liaison between two vertices, if any
+    ////////////////////////////////////////////////////////////
+    const Liaison* getLiaison(size_t vertex1, size_t vertex2) const;
+
+    ////////////////////////////////////////////////////////////
+    // Check if the edge between two vertices borders a single face
+    ////////////////////////////////////////////////////////////
+    bool isBoundary(size_t vertex1, size_t vertex2) const;
+
+    ////////////////////////////////////////////////////////////
+    // Get the loops of vertices bordering the faces, following their winding
+    ////////////////////////////////////////////////////////////
+    const std::vector<std::vector<size_t>>& getBoundaries() const;
+
+    ////////////////////////////////////////////////////////////
+    // Rebuild the tables now if the geom changed
+    ////////////////////////////////////////////////////////////
+    void update() const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    // Flags the tables when the elements of the geom change
+    ////////////////////////////////////////////////////////////
+    struct Listener : public Geom::Observer
+    {
+        Listener(Topology& topology);
+        void onVertexAdded();
+        void onLiaisonAdded();
+        void onFaceAdded();
+        void onVertexRemoved(size_t id);
+        void onLiaisonRemoved(size_t id);
+        void onFaceRemoved(size_t id);
+        void onErasing();
+        void onEdited(const Geom::Changes& changes);
+        Topology& topology;
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Compressed rows of indices, one row per vertex, a full row
+    // being moved to the end of the items to grow
+    ////////////////////////////////////////////////////////////
+    struct Table
+    {
+        Indices get(size_t row) const;
+        bool contains(size_t row, size_t item) const;
+        void addRow();
+        void add(size_t row, size_t item);
+        std::vector<size_t> begins;
+        std::vector<size_t> ends;
+        std::vector<size_t> limits;
+        std::vector<size_t> items;
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Copy is forbidden, the geom holds the listener
+    ////////////////////////////////////////////////////////////
+    Topology(const Topology&);
+    Topology& operator=(const Topology&);
+
+    ////////////////////////////////////////////////////////////
+    // Mark the tables to be rebuilt
+    ////////////////////////////////////////////////////////////
+    void invalidate();
+
+    ////////////////////////////////////////////////////////////
+    // Add the vertices of the range, appended to the geom, to the tables
+    ////////////////////////////////////////////////////////////
+    void addVertices(size_t begin, size_t end);
+
+    ////////////////////////////////////////////////////////////
+    // Add the liaisons of the range, appended to the geom, to the tables
+    ////////////////////////////////////////////////////////////
+    void addLiaisons(size_t begin, size_t end);
+
+    ////////////////////////////////////////////////////////////
+    // Add the faces of the range, appended to the geom, to the tables
+    ////////////////////////////////////////////////////////////
+    void addFaces(size_t begin, size_t end);
+
+    ////////////////////////////////////////////////////////////
+    // Link two vertices in the neighbours table, once
+    ////////////////////////////////////////////////////////////
+    void addNeighbours(size_t vertex1, size_t vertex2);
+
+    ////////////////////////////////////////////////////////////
+    // Compute the boundary loops
+    ////////////////////////////////////////////////////////////
+    void computeBoundaries() const;
+
+    ////////////////////////////////////////////////////////////
+    // Fill a table from pairs of rows & items
+    ////////////////////////////////////////////////////////////
+    static void fill(Table& table, size_t rowsCount, const std::vector<size_t>& rows, const std::vector<size_t>& items);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Geom&                                    m_geom;
+    Listener                                 m_listener;
+    mutable bool                             m_updated;
+    mutable bool                             m_boundariesUpdated;
+    mutable Table                            m_neighbours;
+    mutable Table                            m_liaisons;
+    mutable Table                            m_faces;
+    mutable std::vector<std::vector<size_t>> m_boundaries;
+};
+
+}
+
+#endif // ZOOST_TOPOLOGY_HPP
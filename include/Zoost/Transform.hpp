@@ -29,6 +29,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <array>
+#include <vector>
 #include <Zoost/Vector2.hpp>
 #include <Zoost/Config.hpp>
 
@@ -71,6 +72,21 @@ public:
     ////////////////////////////////////////////////////////////    
     Vector2d getMultiplication(const Vector2d& vector);
 
+    ////////////////////////////////////////////////////////////
+    // Multiply an array of points, the results may be the points
+    ////////////////////////////////////////////////////////////    
+    void getMultiplication(const Vector2d* points, Vector2d* results, size_t count) const;
+
+    ////////////////////////////////////////////////////////////
+    // Multiply the points, stored as separate coordinates arrays
+    ////////////////////////////////////////////////////////////    
+    void getMultiplication(const double* pointsX, const double* pointsY, double* resultsX, double* resultsY, size_t count) const;
+
+    ////////////////////////////////////////////////////////////
+    // Multiply a list of points
+    ////////////////////////////////////////////////////////////    
+    void getMultiplication(const std::vector<Vector2d>& points, std::vector<Vector2d>& results) const;
+
     ////////////////////////////////////////////////////////////
     // Get the multiplication by the given transformation
     ////////////////////////////////////////////////////////////    
@@ -125,6 +141,11 @@ public:
     // Get the determinant
     ////////////////////////////////////////////////////////////   
     double getDeterminant();
+
+    ////////////////////////////////////////////////////////////
+    // Check if the bottom row is (0, 0, 1), enabling the fast paths
+    ////////////////////////////////////////////////////////////
+    bool isAffine() const;
     
     ////////////////////////////////////////////////////////////
     // Get a translation matrix
@@ -49,10 +49,45 @@ public:
     Transformable(const Vector2d& position = Vector2d(0, 0), double rotation = 0, const Vector2d& scale = Vector2d(1, 1));
 
     ////////////////////////////////////////////////////////////
-    // Assignement operator
+    // Copy constructor, the copy has no parent nor children
+    ////////////////////////////////////////////////////////////
+    Transformable(const Transformable& transformable);
+
+    ////////////////////////////////////////////////////////////
+    // Destructor, detach the transformable from the hierarchy
+    ////////////////////////////////////////////////////////////
+    virtual ~Transformable();
+
+    ////////////////////////////////////////////////////////////
+    // Assignement operator, the hierarchy links are kept
     ////////////////////////////////////////////////////////////
     Transformable& operator=(const Transformable& transformable);
 
+    ////////////////////////////////////////////////////////////
+    // Set the parent, whose transform applies before this one
+    ////////////////////////////////////////////////////////////
+    void setParent(Transformable* parent);
+
+    ////////////////////////////////////////////////////////////
+    // Get the parent
+    ////////////////////////////////////////////////////////////
+    Transformable* getParent() const;
+
+    ////////////////////////////////////////////////////////////
+    // Attach a child
+    ////////////////////////////////////////////////////////////
+    void addChild(Transformable& child);
+
+    ////////////////////////////////////////////////////////////
+    // Detach a child
+    ////////////////////////////////////////////////////////////
+    void removeChild(Transformable& child);
+
+    ////////////////////////////////////////////////////////////
+    // Get the children
+    ////////////////////////////////////////////////////////////
+    const std::vector<Transformable*>& getChildren() const;
+
     ////////////////////////////////////////////////////////////
     // Reset the transform
     ////////////////////////////////////////////////////////////
@@ -189,7 +224,12 @@ public:
     const Vector2d& getOrigin() const;
 
     ////////////////////////////////////////////////////////////
-    // get the transformation
+    // Get the transformation relative to the parent
+    ////////////////////////////////////////////////////////////    
+    Transform& getLocalTransform() const;
+
+    ////////////////////////////////////////////////////////////
+    // get the transformation, parents included
     ////////////////////////////////////////////////////////////    
     Transform& getTransform() const;
 
@@ -218,6 +258,21 @@ public:
     ////////////////////////////////////////////////////////////
     Rect convertToLocal(const Rect& rect) const;
     
+    ////////////////////////////////////////////////////////////
+    // Convert an array of points to local coordinates
+    ////////////////////////////////////////////////////////////
+    void convertToLocal(const Point* points, Point* results, size_t count) const;
+
+    ////////////////////////////////////////////////////////////
+    // Convert separate coordinates arrays to local coordinates
+    ////////////////////////////////////////////////////////////
+    void convertToLocal(const double* pointsX, const double* pointsY, double* resultsX, double* resultsY, size_t count) const;
+
+    ////////////////////////////////////////////////////////////
+    // Convert a list of points to local coordinates in place
+    ////////////////////////////////////////////////////////////
+    void convertToLocal(std::vector<Point>& points) const;
+    
     ////////////////////////////////////////////////////////////
     // Convert a point to global coordinates
     ////////////////////////////////////////////////////////////
@@ -238,24 +293,53 @@ public:
     ////////////////////////////////////////////////////////////
     Rect convertToGlobal(const Rect& rect) const;
 
+    ////////////////////////////////////////////////////////////
+    // Convert an array of points to global coordinates
+    ////////////////////////////////////////////////////////////
+    void convertToGlobal(const Point* points, Point* results, size_t count) const;
+
+    ////////////////////////////////////////////////////////////
+    // Convert separate coordinates arrays to global coordinates
+    ////////////////////////////////////////////////////////////
+    void convertToGlobal(const double* pointsX, const double* pointsY, double* resultsX, double* resultsY, size_t count) const;
+
+    ////////////////////////////////////////////////////////////
+    // Convert a list of points to global coordinates in place
+    ////////////////////////////////////////////////////////////
+    void convertToGlobal(std::vector<Point>& points) const;
+
 protected:
 
     ////////////////////////////////////////////////////////////
-    // Method called when a the transform is updated
+    // Mark the transform as outdated & notify the change
+    ////////////////////////////////////////////////////////////
+    void invalidateTransform();
+
+    ////////////////////////////////////////////////////////////
+    // Mark the transforms of the subtree as outdated
+    ////////////////////////////////////////////////////////////
+    void invalidateGlobalTransform();
+
+    ////////////////////////////////////////////////////////////
+    // Method called when a the transform is modified
     ////////////////////////////////////////////////////////////
     virtual void onTransformUpdated() const {}
 
     ////////////////////////////////////////////////////////////
     // Data members
     ////////////////////////////////////////////////////////////    
-    mutable bool      m_transformUpdated = true,
-                      m_invTransformUpdated = true;
-    mutable Transform m_transform,
-                      m_invTransform;
-    Point             m_origin;
-    Point             m_position;
-    Vector2d          m_scale;
-    double            m_rotation;
+    mutable bool                m_localTransformUpdated = false,
+                                m_transformUpdated = false,
+                                m_invTransformUpdated = false;
+    mutable Transform           m_localTransform,
+                                m_transform,
+                                m_invTransform;
+    Point                       m_origin;
+    Point                       m_position;
+    Vector2d                    m_scale;
+    double                      m_rotation;
+    Transformable*              m_parent = nullptr;
+    std::vector<Transformable*> m_children;
 };
 
 }
@@ -52,6 +52,11 @@ public:
     // Check if the triangle contains a point
     ////////////////////////////////////////////////////////////
     static bool contains(const Point& point1, const Point& point2, const Point& point3, const Point& point);
+
+    ////////////////////////////////////////////////////////////
+    // Set the results of the contained points among the given ones
+    ////////////////////////////////////////////////////////////
+    static void contains(const Point& point1, const Point& point2, const Point& point3, const double* pointsX, const double* pointsY, size_t count, Uint8* results);
         
     ////////////////////////////////////////////////////////////
     // Member data
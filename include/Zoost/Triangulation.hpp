@@ -0,0 +1,64 @@
+////////////////////////////////////////////////////////////
+//
+// Zoost C++ library
+// Copyright (C) 2011-2012 Pierre-Emmanuel BRIAN (zinlibs@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#ifndef ZOOST_TRIANGULATION_HPP
+#define ZOOST_TRIANGULATION_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <vector>
+#include <Zoost/Vector2.hpp>
+#include <Zoost/Config.hpp>
+
+namespace zin
+{
+
+namespace Triangulation
+{
+
+////////////////////////////////////////////////////////////
+// Triangulate a simple polygon, adding three indices per triangle
+////////////////////////////////////////////////////////////
+void ZOOST_API earClipping(const Point* points, size_t count, std::vector<size_t>& triangles);
+
+////////////////////////////////////////////////////////////
+// Triangulate the polygon following the indices of the ring
+////////////////////////////////////////////////////////////
+void ZOOST_API earClipping(const Point* points, const std::vector<size_t>& ring, std::vector<size_t>& triangles);
+
+////////////////////////////////////////////////////////////
+// Triangulate the polygon of the first ring, with the next rings as holes
+////////////////////////////////////////////////////////////
+void ZOOST_API earClipping(const Point* points, const std::vector<std::vector<size_t>>& rings, std::vector<size_t>& triangles);
+
+////////////////////////////////////////////////////////////
+// Join holes to an outer ring through bridges, into a single ring
+////////////////////////////////////////////////////////////
+void ZOOST_API bridge(const Point* points, const std::vector<std::vector<size_t>>& rings, std::vector<size_t>& ring);
+
+}
+
+}
+
+#endif // ZOOST_TRIANGULATION_HPP
@@ -52,7 +52,7 @@ struct ZOOST_API Vertex
     ////////////////////////////////////////////////////////////
     // Get the coords of the vertex
     ////////////////////////////////////////////////////////////   
-    const Coords& getCoords() const;
+    Coords getCoords() const;
 
     ////////////////////////////////////////////////////////////
     // Get indice
@@ -66,7 +66,7 @@ private:
     ////////////////////////////////////////////////////////////
     // Default constructor
     ////////////////////////////////////////////////////////////
-    Vertex(const Coords& coords, const Geom& geom);
+    Vertex(size_t indice, const Geom& geom);
 
     ////////////////////////////////////////////////////////////
     // Copy constructor
@@ -81,8 +81,8 @@ private:
     ////////////////////////////////////////////////////////////
     // Data member
     ////////////////////////////////////////////////////////////
-    const Geom& m_geom;
-    Coords      m_coords;
+    const Geom* m_geom;
+    size_t      m_indice;
 };
 
 }
@@ -0,0 +1,259 @@
+////////////////////////////////////////////////////////////
+//
+// Zoost C++ library
+// Copyright (C) 2011-2012 Pierre-Emmanuel BRIAN (zinlibs@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#include <Zoost/Bezier.hpp>
+#include <Zoost/Math.hpp>
+
+namespace zin
+{
+
+////////////////////////////////////////////////////////////
+const size_t Bezier::MaxHornerDegree;
+
+////////////////////////////////////////////////////////////
+Bezier::Bezier(const Point* keyPoints, size_t count) :
+m_keyPoints(keyPoints, keyPoints + count)
+{
+    update();
+}
+
+////////////////////////////////////////////////////////////
+Bezier::Bezier(const std::initializer_list<Point>& keyPoints) :
+m_keyPoints(keyPoints)
+{
+    update();
+}
+
+////////////////////////////////////////////////////////////
+size_t Bezier::getDegree() const
+{
+    return m_keyPoints.empty() ? 0 : m_keyPoints.size() - 1;
+}
+
+////////////////////////////////////////////////////////////
+const std::vector<Point>& Bezier::getKeyPoints() const
+{
+    return m_keyPoints;
+}
+
+////////////////////////////////////////////////////////////
+Point Bezier::operator[](double factor) const
+{
+    if( m_keyPoints.size() < 2 )
+        return m_keyPoints.empty() ? Point(0, 0) : m_keyPoints[0];
+
+    if( factor > 1 )
+        factor = 1;
+
+    else if( factor < 0 )
+        factor = 0;
+
+    size_t degree = getDegree();
+
+    // The usual low degrees take their basis from the compile time binomial rows
+    if( degree == 2 )
+        return evaluate<2>(factor);
+
+    else if( degree == 3 )
+        return evaluate<3>(factor);
+
+    else if( degree > MaxHornerDegree )
+        return deCasteljau(factor);
+
+    // Horner scheme on the Bernstein form, B(t) = (1 - t)^n * sum(C(n, i) * P_i * s^i)
+    // with s = t / (1 - t), or mirrored past the middle so that s never exceeds 1
+    double x, y, scale = 1;
+
+    if( factor < 0.5 )
+    {
+        double complement = 1 - factor, s = factor / complement;
+        x = m_weights[degree].x;
+        y = m_weights[degree].y;
+
+        for( size_t k(degree); k-- > 0; )
+        {
+            x = x * s + m_weights[k].x;
+            y = y * s + m_weights[k].y;
+            scale*=complement;
+        }
+    }
+
+    else
+    {
+        double s = (1 - factor) / factor;
+        x = m_weights[0].x;
+        y = m_weights[0].y;
+
+        for( size_t k(1); k <= degree; k++ )
+        {
+            x = x * s + m_weights[k].x;
+            y = y * s + m_weights[k].y;
+            scale*=factor;
+        }
+    }
+
+    return Point(x * scale, y * scale);
+}
+
+////////////////////////////////////////////////////////////
+void Bezier::evaluate(const double* factors, size_t count, Point* points) const
+{
+    for( size_t k(0); k < count; k++ )
+        points[k] = (*this)[factors[k]];
+}
+
+////////////////////////////////////////////////////////////
+void Bezier::sample(size_t count, std::vector<Point>& points) const
+{
+    points.resize(count);
+
+    if( count == 0 )
+        return;
+
+    if( count == 1 || m_keyPoints.size() < 2 )
+    {
+        for( auto& point : points )
+            point = (*this)[0];
+
+        return;
+    }
+
+    if( m_keyPoints.size() == 4 )
+    {
+        // Forward differencing on the power form a * t^3 + b * t^2 + c * t + d,
+        // three additions per point instead of a full evaluation
+        const Point* keys = m_keyPoints.data();
+        double h = 1.0 / double(count - 1), h2 = h * h, h3 = h2 * h,
+               ax = keys[3].x - 3 * keys[2].x + 3 * keys[1].x - keys[0].x,
+               ay = keys[3].y - 3 * keys[2].y + 3 * keys[1].y - keys[0].y,
+               bx = 3 * (keys[2].x - 2 * keys[1].x + keys[0].x),
+               by = 3 * (keys[2].y - 2 * keys[1].y + keys[0].y),
+               cx = 3 * (keys[1].x - keys[0].x),
+               cy = 3 * (keys[1].y - keys[0].y),
+               x = keys[0].x,
+               y = keys[0].y,
+               dx1 = ax * h3 + bx * h2 + cx * h,
+               dy1 = ay * h3 + by * h2 + cy * h,
+               dx3 = 6 * ax * h3,
+               dy3 = 6 * ay * h3,
+               dx2 = dx3 + 2 * bx * h2,
+               dy2 = dy3 + 2 * by * h2;
+
+        for( size_t k(0); k + 1 < count; k++ )
+        {
+            points[k] = Point(x, y);
+
+            x+=dx1;
+            y+=dy1;
+            dx1+=dx2;
+            dy1+=dy2;
+            dx2+=dx3;
+            dy2+=dy3;
+        }
+
+        // The last point is set exactly, the accumulated rounding errors aside
+        points[count - 1] = keys[3];
+
+        return;
+    }
+
+    for( size_t k(0); k < count; k++ )
+        points[k] = (*this)[double(k) / double(count - 1)];
+}
+
+////////////////////////////////////////////////////////////
+void Bezier::split(double factor, Bezier& left, Bezier& right) const
+{
+    size_t size = m_keyPoints.size();
+    std::vector<Point> keys = m_keyPoints;
+
+    left.m_keyPoints.resize(size);
+    right.m_keyPoints.resize(size);
+
+    for( size_t i(0); i < size; i++ )
+    {
+        left.m_keyPoints[i] = keys[0];
+        right.m_keyPoints[size - 1 - i] = keys[size - 1 - i];
+
+        for( size_t j(0); j + 1 < size - i; j++ )
+            keys[j] = Point(keys[j].x + (keys[j + 1].x - keys[j].x) * factor, keys[j].y + (keys[j + 1].y - keys[j].y) * factor);
+    }
+
+    left.update();
+    right.update();
+}
+
+////////////////////////////////////////////////////////////
+void Bezier::update()
+{
+    size_t degree = getDegree();
+
+    m_weights.resize(m_keyPoints.size());
+
+    if( degree > MaxHornerDegree )
+        return;
+
+    // Binomial row built by C(n, k) = C(n, k - 1) * (n - k + 1) / k, far from overflowing at any usual degree
+    double coef = 1;
+
+    for( size_t k(0); k < m_keyPoints.size(); k++ )
+    {
+        if( k > 0 )
+            coef = coef * double(degree - k + 1) / double(k);
+
+        m_weights[k] = Point(m_keyPoints[k].x * coef, m_keyPoints[k].y * coef);
+    }
+}
+
+////////////////////////////////////////////////////////////
+template <unsigned int N>
+Point Bezier::evaluate(double factor) const
+{
+    double basis[N + 1], x = 0, y = 0;
+    Math::bernsteins<N>(factor, basis);
+
+    for( unsigned int k(0); k <= N; k++ )
+    {
+        x+=m_keyPoints[k].x * basis[k];
+        y+=m_keyPoints[k].y * basis[k];
+    }
+
+    return Point(x, y);
+}
+
+////////////////////////////////////////////////////////////
+Point Bezier::deCasteljau(double factor) const
+{
+    std::vector<Point> keys = m_keyPoints;
+
+    for( size_t i(keys.size() - 1); i > 0; i-- )
+    {
+        for( size_t j(0); j < i; j++ )
+            keys[j] = Point(keys[j].x + (keys[j + 1].x - keys[j].x) * factor, keys[j].y + (keys[j + 1].y - keys[j].y) * factor);
+    }
+
+    return keys[0];
+}
+
+}
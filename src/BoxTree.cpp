@@ -0,0 +1,187 @@
+////////////////////////////////////////////////////////////
+//
+// Zoost C++ library
+// Copyright (C) 2011-2012 Pierre-Emmanuel BRIAN (zinlibs@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#include <Zoost/BoxTree.hpp>
+#include <algorithm>
+
+namespace zin
+{
+
+////////////////////////////////////////////////////////////
+void BoxTree::build(const std::vector<Box>& boxes)
+{
+    m_nodes.clear();
+
+    if( boxes.empty() )
+        return;
+
+    std::vector<size_t> indices(boxes.size());
+
+    for( size_t k(0); k < indices.size(); k++ )
+        indices[k] = k;
+
+    m_nodes.reserve(2 * boxes.size() - 1);
+    build(boxes, indices, 0, indices.size());
+}
+
+////////////////////////////////////////////////////////////
+size_t BoxTree::build(const std::vector<Box>& boxes, std::vector<size_t>& indices, size_t begin, size_t end)
+{
+    size_t node = m_nodes.size();
+    m_nodes.push_back(Node{boxes[indices[begin]], 0, 0, indices[begin]});
+
+    if( end - begin > 1 )
+    {
+        Point min = boxes[indices[begin]].min + boxes[indices[begin]].max, max = min;
+
+        for( size_t k(begin + 1); k < end; k++ )
+        {
+            Point center = boxes[indices[k]].min + boxes[indices[k]].max;
+
+            min = Point(std::min(center.x, min.x), std::min(center.y, min.y));
+            max = Point(std::max(center.x, max.x), std::max(center.y, max.y));
+        }
+
+        bool axisX = max.x - min.x >= max.y - min.y;
+        size_t middle = (begin + end) / 2;
+
+        std::nth_element(indices.begin() + begin, indices.begin() + middle, indices.begin() + end, [&](size_t a, size_t b)
+        {
+            return axisX ? boxes[a].min.x + boxes[a].max.x < boxes[b].min.x + boxes[b].max.x
+                         : boxes[a].min.y + boxes[a].max.y < boxes[b].min.y + boxes[b].max.y;
+        });
+
+        size_t left = build(boxes, indices, begin, middle), right = build(boxes, indices, middle, end);
+
+        m_nodes[node].box    = merge(m_nodes[left].box, m_nodes[right].box);
+        m_nodes[node].left   = left;
+        m_nodes[node].right  = right;
+        m_nodes[node].indice = boxes.size();
+    }
+
+    return node;
+}
+
+////////////////////////////////////////////////////////////
+void BoxTree::refit(const std::vector<Box>& boxes)
+{
+    for( size_t k(m_nodes.size()); k > 0; k-- )
+    {
+        Node& node = m_nodes[k - 1];
+
+        if( node.indice < boxes.size() )
+            node.box = boxes[node.indice];
+
+        else node.box = merge(m_nodes[node.left].box, m_nodes[node.right].box);
+    }
+}
+
+////////////////////////////////////////////////////////////
+void BoxTree::clear()
+{
+    m_nodes.clear();
+}
+
+////////////////////////////////////////////////////////////
+size_t BoxTree::getBoxesCount() const
+{
+    return (m_nodes.size() + 1) / 2;
+}
+
+////////////////////////////////////////////////////////////
+BoxTree::Box BoxTree::getBounds() const
+{
+    return m_nodes.empty() ? Box() : m_nodes[0].box;
+}
+
+////////////////////////////////////////////////////////////
+void BoxTree::query(const Box& box, std::vector<size_t>& indices) const
+{
+    if( m_nodes.empty() )
+        return;
+
+    size_t count = getBoxesCount();
+    std::vector<size_t> stack(1, 0);
+
+    while( !stack.empty() )
+    {
+        const Node& node = m_nodes[stack.back()];
+        stack.pop_back();
+
+        if( intersects(node.box, box) )
+        {
+            if( node.indice < count )
+                indices.push_back(node.indice);
+
+            else
+            {
+                stack.push_back(node.right);
+                stack.push_back(node.left);
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////
+void BoxTree::query(const Point& point, std::vector<size_t>& indices) const
+{
+    query(Box{point, point}, indices);
+}
+
+////////////////////////////////////////////////////////////
+bool BoxTree::intersects(const Box& box1, const Box& box2)
+{
+    return box1.min.x <= box2.max.x && box2.min.x <= box1.max.x && box1.min.y <= box2.max.y && box2.min.y <= box1.max.y;
+}
+
+////////////////////////////////////////////////////////////
+double BoxTree::squaredDistance(const Box& box, const Point& point)
+{
+    double dx = std::max(std::max(box.min.x - point.x, point.x - box.max.x), 0.0),
+           dy = std::max(std::max(box.min.y - point.y, point.y - box.max.y), 0.0);
+
+    return dx * dx + dy * dy;
+}
+
+////////////////////////////////////////////////////////////
+BoxTree::Box BoxTree::merge(const Box& box1, const Box& box2)
+{
+    return Box{Point(std::min(box1.min.x, box2.min.x), std::min(box1.min.y, box2.min.y)),
+               Point(std::max(box1.max.x, box2.max.x), std::max(box1.max.y, box2.max.y))};
+}
+
+////////////////////////////////////////////////////////////
+BoxTree::Box BoxTree::bound(const Point& point1, const Point& point2)
+{
+    return Box{Point(std::min(point1.x, point2.x), std::min(point1.y, point2.y)),
+               Point(std::max(point1.x, point2.x), std::max(point1.y, point2.y))};
+}
+
+////////////////////////////////////////////////////////////
+BoxTree::Box BoxTree::bound(const Point& point1, const Point& point2, const Point& point3)
+{
+    return merge(bound(point1, point2), Box{point3, point3});
+}
+
+}
@@ -0,0 +1,338 @@
+////////////////////////////////////////////////////////////
+//
+// Zoost C++ library
+// Copyright (C) 2011-2012 Pierre-Emmanuel BRIAN (zinlibs@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#include <Zoost/CollisionWorld.hpp>
+#include <algorithm>
+
+namespace zin
+{
+
+////////////////////////////////////////////////////////////
+CollisionWorld::Body::Body(CollisionWorld& world, Geom& geom, Uint32 id) :
+world(world),
+geom(geom),
+id(id),
+dirty(false),
+removed(false) {}
+
+////////////////////////////////////////////////////////////
+void CollisionWorld::Body::onTransformUpdated()
+{
+    world.invalidate(*this);
+}
+
+////////////////////////////////////////////////////////////
+void CollisionWorld::Body::onVertexAdded()
+{
+    world.invalidate(*this);
+}
+
+////////////////////////////////////////////////////////////
+void CollisionWorld::Body::onVertexRemoved(size_t)
+{
+    world.invalidate(*this);
+}
+
+////////////////////////////////////////////////////////////
+void CollisionWorld::Body::onVertexMoved()
+{
+    world.invalidate(*this);
+}
+
+////////////////////////////////////////////////////////////
+void CollisionWorld::Body::onErasing()
+{
+    world.invalidate(*this);
+}
+
+////////////////////////////////////////////////////////////
+void CollisionWorld::Body::onEdited(const Geom::Changes&)
+{
+    world.invalidate(*this);
+}
+
+////////////////////////////////////////////////////////////
+CollisionWorld::CollisionWorld() :
+m_entriesAdded(false),
+m_sweepY(false) {}
+
+////////////////////////////////////////////////////////////
+CollisionWorld::~CollisionWorld()
+{
+    for( auto& body : m_bodies )
+    {
+        if( body )
+        {
+            if( !body->removed )
+                body->geom.removeObserver(*body);
+
+            delete body;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////
+void CollisionWorld::add(Geom& geom)
+{
+    if( contains(geom) )
+        return;
+
+    Uint32 id;
+
+    if( !m_freeIds.empty() )
+    {
+        id = m_freeIds.back();
+        m_freeIds.pop_back();
+    }
+
+    else
+    {
+        id = m_bodies.size();
+        m_bodies.push_back(nullptr);
+        m_boxes.push_back(BoxTree::Box());
+    }
+
+    m_bodies[id] = new Body(*this, geom, id);
+    m_ids[&geom] = id;
+
+    m_entries.push_back(Entry{0, 0, 0, 0, id});
+    m_entriesAdded = true;
+
+    geom.addObserver(*m_bodies[id]);
+    invalidate(*m_bodies[id]);
+}
+
+////////////////////////////////////////////////////////////
+void CollisionWorld::remove(Geom& geom)
+{
+    auto it = m_ids.find(&geom);
+
+    if( it != m_ids.end() )
+    {
+        Body& body = *m_bodies[it->second];
+
+        geom.removeObserver(body);
+        m_ids.erase(it);
+
+        body.removed = true;
+        m_removedIds.push_back(body.id);
+        invalidate(body);
+    }
+}
+
+////////////////////////////////////////////////////////////
+bool CollisionWorld::contains(const Geom& geom) const
+{
+    return m_ids.count(&geom) > 0;
+}
+
+////////////////////////////////////////////////////////////
+size_t CollisionWorld::getGeomsCount() const
+{
+    return m_ids.size();
+}
+
+////////////////////////////////////////////////////////////
+void CollisionWorld::step()
+{
+    m_newPairs.clear();
+    m_lostPairs.clear();
+
+    if( m_dirtyIds.empty() )
+        return;
+
+    for( auto& id : m_dirtyIds )
+    {
+        Body& body = *m_bodies[id];
+        body.dirty = false;
+
+        if( !body.removed )
+        {
+            Rect bounds = body.geom.getGlobalBounds();
+            m_boxes[id] = BoxTree::Box{bounds.pos, bounds.pos + bounds.size};
+        }
+    }
+
+    m_dirtyIds.clear();
+
+    if( !m_removedIds.empty() )
+    {
+        m_entries.erase(std::remove_if(m_entries.begin(), m_entries.end(), [this](const Entry& entry) { return m_bodies[entry.body]->removed; }), m_entries.end());
+    }
+
+    if( m_entriesAdded )
+        chooseAxis();
+
+    for( auto& entry : m_entries )
+    {
+        const BoxTree::Box& box = m_boxes[entry.body];
+
+        if( m_sweepY )
+            entry = Entry{box.min.y, box.max.y, box.min.x, box.max.x, entry.body};
+
+        else
+            entry = Entry{box.min.x, box.max.x, box.min.y, box.max.y, entry.body};
+    }
+
+    auto less = [](const Entry& entry1, const Entry& entry2) { return entry1.min < entry2.min; };
+
+    // Between two steps the order barely changes, so an insertion sort is nearly linear
+    if( m_entriesAdded )
+        std::sort(m_entries.begin(), m_entries.end(), less);
+
+    else
+    {
+        for( size_t k = 1; k < m_entries.size(); ++k )
+        {
+            Entry entry = m_entries[k];
+            size_t j = k;
+
+            for( ; j > 0 && less(entry, m_entries[j - 1]); --j )
+                m_entries[j] = m_entries[j - 1];
+
+            m_entries[j] = entry;
+        }
+    }
+
+    m_entriesAdded = false;
+
+    // Sweep, each box only meets the following ones starting before its end, borders included
+    std::vector<Uint64> keys;
+    keys.reserve(m_keys.size());
+
+    const Entry* entries = m_entries.data();
+    size_t count = m_entries.size();
+
+    for( size_t k = 0; k < count; ++k )
+    {
+        double max = entries[k].max, otherMin = entries[k].otherMin, otherMax = entries[k].otherMax;
+
+        for( size_t j = k + 1; j < count && entries[j].min <= max; ++j )
+        {
+            if( otherMin <= entries[j].otherMax && entries[j].otherMin <= otherMax )
+                keys.push_back(getKey(entries[k].body, entries[j].body));
+        }
+    }
+
+    std::sort(keys.begin(), keys.end());
+
+    // Compare with the previous step, the removed bodies are still alive for their lost pairs
+    for( size_t k = 0, j = 0; k < keys.size() || j < m_keys.size(); )
+    {
+        if( j == m_keys.size() || ( k < keys.size() && keys[k] < m_keys[j] ) )
+            m_newPairs.push_back(getPair(keys[k++]));
+
+        else if( k == keys.size() || m_keys[j] < keys[k] )
+            m_lostPairs.push_back(getPair(m_keys[j++]));
+
+        else
+        {
+            ++k;
+            ++j;
+        }
+    }
+
+    m_keys.swap(keys);
+
+    if( !m_newPairs.empty() || !m_lostPairs.empty() )
+    {
+        m_pairs.clear();
+        m_pairs.reserve(m_keys.size());
+
+        for( auto& key : m_keys )
+            m_pairs.push_back(getPair(key));
+    }
+
+    for( auto& id : m_removedIds )
+    {
+        delete m_bodies[id];
+        m_bodies[id] = nullptr;
+        m_freeIds.push_back(id);
+    }
+
+    m_removedIds.clear();
+}
+
+////////////////////////////////////////////////////////////
+const std::vector<CollisionWorld::Pair>& CollisionWorld::getPairs() const
+{
+    return m_pairs;
+}
+
+////////////////////////////////////////////////////////////
+const std::vector<CollisionWorld::Pair>& CollisionWorld::getNewPairs() const
+{
+    return m_newPairs;
+}
+
+////////////////////////////////////////////////////////////
+const std::vector<CollisionWorld::Pair>& CollisionWorld::getLostPairs() const
+{
+    return m_lostPairs;
+}
+
+////////////////////////////////////////////////////////////
+void CollisionWorld::invalidate(Body& body)
+{
+    if( !body.dirty )
+    {
+        body.dirty = true;
+        m_dirtyIds.push_back(body.id);
+    }
+}
+
+////////////////////////////////////////////////////////////
+void CollisionWorld::chooseAxis()
+{
+    double sumX = 0, sumY = 0, squaresX = 0, squaresY = 0;
+
+    for( auto& entry : m_entries )
+    {
+        const BoxTree::Box& box = m_boxes[entry.body];
+        double centerX = (box.min.x + box.max.x) / 2, centerY = (box.min.y + box.max.y) / 2;
+
+        sumX += centerX;
+        sumY += centerY;
+        squaresX += centerX * centerX;
+        squaresY += centerY * centerY;
+    }
+
+    double count = m_entries.size() ? m_entries.size() : 1;
+
+    m_sweepY = squaresY / count - (sumY / count) * (sumY / count) > squaresX / count - (sumX / count) * (sumX / count);
+}
+
+////////////////////////////////////////////////////////////
+CollisionWorld::Pair CollisionWorld::getPair(Uint64 key) const
+{
+    return Pair{&m_bodies[key >> 32]->geom, &m_bodies[key & 0xFFFFFFFF]->geom};
+}
+
+////////////////////////////////////////////////////////////
+Uint64 CollisionWorld::getKey(Uint32 body1, Uint32 body2)
+{
+    return body1 < body2 ? (Uint64(body1) << 32) | body2 : (Uint64(body2) << 32) | body1;
+}
+
+}
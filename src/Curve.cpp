@@ -23,8 +23,12 @@
 /////////////////////////////////////////////////////////////
 
 #include <Zoost/Curve.hpp>
+#include <Zoost/Bezier.hpp>
 #include <Zoost/Math.hpp>
 #include <Zoost/Segment.hpp>
+#include <algorithm>
+#include <cmath>
+#include <utility>
 
 namespace zin
 {
@@ -42,22 +46,37 @@ Curve::Curve(const Curve& curve)
     add(curve);
 }
 
+////////////////////////////////////////////////////////////
+Curve::Curve(Curve&& curve) :
+Geom(std::move(curve)) {}
+
 ////////////////////////////////////////////////////////////
 Curve& Curve::operator=(const Curve& curve)
 {
-    m_length = 0;
     Geom::operator=(curve);
     
     return *this;
 }
 
+////////////////////////////////////////////////////////////
+Curve& Curve::operator=(Curve&& curve)
+{
+    Geom::operator=(std::move(curve));
+
+    return *this;
+}
+
 ////////////////////////////////////////////////////////////
 Curve& Curve::add(const Curve& curve)
 {
     size_t offset = getVerticesCount();
 
-    for( auto& vertex : curve.m_vertices )
-        addVertex(convertToLocal(curve.convertToGlobal(vertex->getCoords())));
+    std::vector<Coords> coords;
+    curve.getGlobalCoords(coords);
+    convertToLocal(coords);
+
+    for( auto& point : coords )
+        addVertex(point);
 
     return *this;
 }
@@ -66,7 +85,9 @@ Curve& Curve::add(const Curve& curve)
 Curve Curve::operator+(const Curve& curve)
 {
     Curve copy = *this;
-    return copy.add(curve);
+    copy.add(curve);
+
+    return copy;
 }
 
 ////////////////////////////////////////////////////////////
@@ -81,45 +102,198 @@ Vertex& Curve::addVertex(const Point& point)
     Vertex& vertex = Geom::addVertex(point);
 
     if( getVerticesCount() > 1 )
-        m_length+=Geom::addLiaison(getVertex(getVerticesCount() - 2), vertex).getSegment().length();
+    {
+        // A valid table is extended rather than rebuilt on the next query
+        bool updated = m_lengthsUpdated && m_lengths.size() == m_liaisons.size() + 1;
+        Liaison& liaison = Geom::addLiaison(getVertex(getVerticesCount() - 2), vertex);
+
+        if( updated )
+            m_lengths.push_back(m_lengths.back() + Segment(liaison.v1.getCoords(), liaison.v2.getCoords()).length());
+    }
 
     return getVertex(getVerticesCount() - 1);
 }
 
+////////////////////////////////////////////////////////////
+void Curve::clear()
+{
+    Geom::clear();
+
+    m_lengths.clear();
+    m_lengthsUpdated = false;
+}
+
 ////////////////////////////////////////////////////////////
 Coords Curve::operator[](double factor) const
 {
-    size_t size = getVerticesCount();
+    if( m_liaisons.empty() )
+        return getVerticesCount() > 0 ? getVertex(0).getCoords() : Coords(0, 0);
+
+    if( factor > 1 )
+        factor = 1;
 
-    if( size > 1 )
+    else if( factor < 0 )
+        factor = 0;
+
+    const std::vector<double>& lengths = getLengths();
+    double distance = lengths.back() * factor;
+
+    // First liaison ending at or after the distance, the last one catching the rounding errors
+    size_t indice = std::lower_bound(lengths.begin() + 1, lengths.end() - 1, distance) - lengths.begin() - 1;
+
+    return interpolate(indice, distance);
+}
+
+////////////////////////////////////////////////////////////
+void Curve::sample(size_t count, std::vector<Coords>& points) const
+{
+    points.resize(count);
+
+    if( count == 0 )
+        return;
+
+    if( m_liaisons.empty() )
     {
-        if( factor > 1 )
-            factor = 1;
-
-        else if( factor < 0 )
-            factor = 0;
-        
-        double distPoint = m_length * factor, dist = 0;
-        
-        for( auto& liaison : m_liaisons )
+        for( auto& point : points )
+            point = (*this)[0];
+
+        return;
+    }
+
+    const std::vector<double>& lengths = getLengths();
+    double step = count > 1 ? lengths.back() / double(count - 1) : 0;
+    size_t indice = 0;
+
+    for( size_t k(0); k < count; k++ )
+    {
+        double distance = k + 1 < count ? step * double(k) : lengths.back();
+
+        while( indice + 1 < m_liaisons.size() && lengths[indice + 1] < distance )
+            indice++;
+
+        points[k] = interpolate(indice, distance);
+    }
+}
+
+////////////////////////////////////////////////////////////
+Curve::Projection Curve::project(const Point& point) const
+{
+    Projection projection;
+    project(&point, 1, &projection);
+
+    return projection;
+}
+
+////////////////////////////////////////////////////////////
+void Curve::project(const Point* points, size_t count, Projection* projections) const
+{
+    if( count == 0 )
+        return;
+
+    std::vector<Point> locals(points, points + count);
+    convertToLocal(locals);
+
+    if( m_liaisons.empty() )
+    {
+        Point point = getVerticesCount() > 0 ? convertToGlobal(getVertex(0).getCoords()) : Point(0, 0);
+
+        for( size_t k(0); k < count; k++ )
+            projections[k] = Projection{point, std::hypot(point.x - points[k].x, point.y - points[k].y), 0, 0};
+
+        return;
+    }
+
+    const BoxTree& tree = getLiaisonTree();
+    const std::vector<double>& lengths = getLengths();
+    size_t previous = 0;
+
+    for( size_t k(0); k < count; k++ )
+    {
+        const Point& local = locals[k];
+
+        auto distance = [&](size_t indice)
         {
-            Segment segment(liaison->v1.getCoords(), liaison->v2.getCoords());
-            double length = segment.length();
+            Point point = Segment(m_liaisons[indice]->v1.getCoords(), m_liaisons[indice]->v2.getCoords())[getNearestFactor(indice, local)];
+            return Math::square(point.x - local.x) + Math::square(point.y - local.y);
+        };
 
-            dist+=length;
-            
-            if( dist >= distPoint )
-                return segment[1 - (dist - distPoint) / length];
-        }
+        // Close points often share their nearest liaison, the previous one bounds the search from the start
+        double squaredDistance = distance(previous);
+        size_t indice = tree.nearest(local, distance, squaredDistance);
+
+        if( indice < m_liaisons.size() )
+            previous = indice;
+
+        double factor = getNearestFactor(previous, local),
+               length = lengths[previous] + (lengths[previous + 1] - lengths[previous]) * factor;
+        Point point = convertToGlobal(Segment(m_liaisons[previous]->v1.getCoords(), m_liaisons[previous]->v2.getCoords())[factor]);
+
+        projections[k] = Projection{point, std::hypot(point.x - points[k].x, point.y - points[k].y), length, lengths.back() > 0 ? length / lengths.back() : 0};
     }
-    
-    else return {0, 0};
 }
 
 ////////////////////////////////////////////////////////////
 double Curve::getLength() const
 {
-    return m_length;
+    return getLengths().back();
+}
+
+////////////////////////////////////////////////////////////
+void Curve::onVertexMoved(size_t indice) const
+{
+    m_lengthsUpdated = false;
+
+    Geom::onVertexMoved(indice);
+}
+
+////////////////////////////////////////////////////////////
+void Curve::onElementsRemoved()
+{
+    m_lengthsUpdated = false;
+
+    Geom::onElementsRemoved();
+}
+
+////////////////////////////////////////////////////////////
+const std::vector<double>& Curve::getLengths() const
+{
+    // The removals drop the table, the liaisons count catches the ones added through the geom
+    if( !m_lengthsUpdated || m_lengths.size() != m_liaisons.size() + 1 )
+    {
+        m_lengths.resize(m_liaisons.size() + 1);
+        m_lengths[0] = 0;
+
+        for( size_t k(0); k < m_liaisons.size(); k++ )
+            m_lengths[k + 1] = m_lengths[k] + Segment(m_liaisons[k]->v1.getCoords(), m_liaisons[k]->v2.getCoords()).length();
+
+        m_lengthsUpdated = true;
+    }
+
+    return m_lengths;
+}
+
+////////////////////////////////////////////////////////////
+Coords Curve::interpolate(size_t indice, double distance) const
+{
+    const Liaison& liaison = *m_liaisons[indice];
+    double length = m_lengths[indice + 1] - m_lengths[indice];
+
+    if( length <= 0 )
+        return liaison.v1.getCoords();
+
+    return Segment(liaison.v1.getCoords(), liaison.v2.getCoords())[(distance - m_lengths[indice]) / length];
+}
+
+////////////////////////////////////////////////////////////
+double Curve::getNearestFactor(size_t indice, const Point& point) const
+{
+    Coords v1 = m_liaisons[indice]->v1.getCoords(), v2 = m_liaisons[indice]->v2.getCoords();
+    double dx = v2.x - v1.x, dy = v2.y - v1.y, length = dx * dx + dy * dy;
+
+    if( length <= 0 )
+        return 0;
+
+    return std::min(std::max(((point.x - v1.x) * dx + (point.y - v1.y) * dy) / length, 0.0), 1.0);
 }
 
 ////////////////////////////////////////////////////////////
@@ -130,16 +304,85 @@ Curve Curve::bezier(const std::initializer_list<Point>& keyPoints, Uint32 comple
     if( complexity < 2 )
 		complexity = 2;
 
-    std::vector<Point> keys = keyPoints;
-        
-    for( Uint32 k(0); k < complexity + 1; k++ )
+    std::vector<Point> points;
+    Bezier(keyPoints).sample(complexity + 1, points);
+
+    for( auto& point : points )
+        curve.addVertex(point);
+
+    return curve;
+}
+
+////////////////////////////////////////////////////////////
+Curve Curve::adaptiveBezier(const std::initializer_list<Point>& keyPoints, double tolerance)
+{
+    Curve curve;
+
+    if( keyPoints.size() == 0 )
+        return curve;
+
+    // Past this depth a span is kept as it is, which bounds the curve to 2^16 liaisons
+    const Uint32 maxDepth = 16;
+    size_t size = keyPoints.size();
+
+    // Control polygons still to subdivide, stored one after the other, the next one on top
+    std::vector<Point> spans(keyPoints);
+    std::vector<Uint32> depths(1, 0);
+    std::vector<Point> keys(size), left(size);
+
+    curve.addVertex(*keyPoints.begin());
+
+    if( size == 1 )
+        return curve;
+
+    while( !depths.empty() )
     {
-    	Point point;
+        Point* span = &spans[spans.size() - size];
+        Uint32 depth = depths.back();
+
+        // The curve lies in the hull of its control polygon, so the polygon
+        // distance to the chord segment bounds the distance of the curve to the liaison
+        double dx = span[size - 1].x - span[0].x,
+               dy = span[size - 1].y - span[0].y,
+               chord = dx * dx + dy * dy;
+        bool flat = true;
+
+        for( size_t k(1); k + 1 < size && flat; k++ )
+        {
+            double ux = span[k].x - span[0].x,
+                   uy = span[k].y - span[0].y,
+                   t = chord > 0 ? std::min(std::max((ux * dx + uy * dy) / chord, 0.0), 1.0) : 0;
+
+            flat = Math::square(ux - dx * t) + Math::square(uy - dy * t) <= tolerance * tolerance;
+        }
+
+        if( flat || depth >= maxDepth )
+        {
+            Point end = span[size - 1];
+
+            spans.resize(spans.size() - size);
+            depths.pop_back();
+            curve.addVertex(end);
+        }
 
-    	for( size_t i(0); i < keyPoints.size(); i++ )
-			point+=(keys[i] * Math::bernstein(i, keys.size() - 1, float(k) / float(complexity)));
+        else
+        {
+            // De Casteljau split at the middle, the right half takes the place of the span
+            keys.assign(span, span + size);
 
-		curve.addVertex(point);
+            for( size_t i(0); i < size; i++ )
+            {
+                left[i] = keys[0];
+                span[size - 1 - i] = keys[size - 1 - i];
+
+                for( size_t j(0); j + 1 < size - i; j++ )
+                    keys[j] = Point((keys[j].x + keys[j + 1].x) * 0.5, (keys[j].y + keys[j + 1].y) * 0.5);
+            }
+
+            depths.back() = depth + 1;
+            depths.push_back(depth + 1);
+            spans.insert(spans.end(), left.begin(), left.end());
+        }
     }
 
     return curve;
@@ -0,0 +1,887 @@
+////////////////////////////////////////////////////////////
+//
+// Zoost C++ library
+// Copyright (C) 2011-2012 Pierre-Emmanuel BRIAN (zinlibs@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#include <Zoost/Delaunay.hpp>
+#include <Zoost/Math.hpp>
+#include <algorithm>
+#include <utility>
+#include <cmath>
+
+namespace zin
+{
+
+////////////////////////////////////////////////////////////
+const Uint32 Delaunay::None;
+
+////////////////////////////////////////////////////////////
+Delaunay::Delaunay() :
+m_last(0),
+m_walks(0) {}
+
+////////////////////////////////////////////////////////////
+void Delaunay::triangulate(const Point* points, size_t count)
+{
+    clear();
+
+    if( count == 0 )
+        return;
+
+    double minX = points[0].x, maxX = minX,
+           minY = points[0].y, maxY = minY;
+
+    for( size_t k(1); k < count; k++ )
+    {
+        minX = std::min(minX, points[k].x);
+        maxX = std::max(maxX, points[k].x);
+        minY = std::min(minY, points[k].y);
+        maxY = std::max(maxY, points[k].y);
+    }
+
+    // The first vertex stands for the point at infinity, closing the hull with ghost triangles
+    m_points.reserve(count + 1);
+    m_points.push_back(Point(0, 0));
+    m_points.insert(m_points.end(), points, points + count);
+
+    m_vertices.reserve(6 * count + 6);
+    m_neighbours.reserve(6 * count + 6);
+    m_constrained.reserve(2 * count + 2);
+    m_vertexTriangles.assign(count + 1, None);
+    m_aliases.resize(count);
+
+    for( size_t k(0); k < count; k++ )
+        m_aliases[k] = k + 1;
+
+    // Inserted along a Hilbert curve, each point is found a few steps away from the previous one
+    std::vector<std::pair<Uint32, Uint32>> order(count);
+
+    double scaleX = maxX > minX ? 65535 / (maxX - minX) : 0,
+           scaleY = maxY > minY ? 65535 / (maxY - minY) : 0;
+
+    for( size_t k(0); k < count; k++ )
+        order[k] = std::make_pair(hilbert(Uint32((points[k].x - minX) * scaleX), Uint32((points[k].y - minY) * scaleY)), Uint32(k));
+
+    std::sort(order.begin(), order.end());
+
+    // Start from the first three points which are not aligned
+    Uint32 a = order[0].second + 1, b = None, c = None;
+
+    for( auto& entry : order )
+    {
+        Uint32 vertex = entry.second + 1;
+
+        if( b == None && m_points[vertex] != m_points[a] )
+            b = vertex;
+
+        else if( b != None && orientation(m_points[a], m_points[b], m_points[vertex]) != 0 )
+        {
+            c = vertex;
+            break;
+        }
+    }
+
+    if( c == None )
+        return;
+
+    if( orientation(m_points[a], m_points[b], m_points[c]) < 0 )
+        std::swap(b, c);
+
+    Uint32 triangle = addTriangle(), ghostC = addTriangle(), ghostA = addTriangle(), ghostB = addTriangle();
+
+    // Each ghost triangle faces the real one through a hull edge, & its neighbours through the infinite edges
+    Uint32 values[4][7] =
+    {
+        {triangle, a, b, c, ghostA, ghostB, ghostC},
+        {ghostC,   b, a, 0, ghostB, ghostA, triangle},
+        {ghostA,   c, b, 0, ghostC, ghostB, triangle},
+        {ghostB,   a, c, 0, ghostA, ghostC, triangle}
+    };
+
+    for( auto& value : values )
+    {
+        for( Uint32 i(0); i < 3; i++ )
+        {
+            m_vertices[value[0] * 3 + i] = value[1 + i];
+            m_neighbours[value[0] * 3 + i] = value[4 + i];
+        }
+    }
+
+    m_vertexTriangles[0] = ghostC;
+    m_vertexTriangles[a] = triangle;
+    m_vertexTriangles[b] = triangle;
+    m_vertexTriangles[c] = triangle;
+
+    for( auto& entry : order )
+    {
+        Uint32 vertex = entry.second + 1;
+
+        if( vertex != a && vertex != b && vertex != c )
+            m_aliases[entry.second] = insert(vertex);
+    }
+}
+
+////////////////////////////////////////////////////////////
+bool Delaunay::constrain(size_t point1, size_t point2)
+{
+    if( point1 >= m_aliases.size() || point2 >= m_aliases.size() )
+        return false;
+
+    Uint32 vertex = m_aliases[point1], target = m_aliases[point2];
+
+    if( m_vertexTriangles[vertex] == None || m_vertexTriangles[target] == None )
+        return false;
+
+    // The edge is split at each vertex lying on it
+    while( vertex != target )
+    {
+        vertex = constrainEdge(vertex, target);
+
+        if( vertex == None )
+            return false;
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////
+void Delaunay::getTriangles(std::vector<size_t>& triangles, bool inside) const
+{
+    Uint32 trianglesCount = m_constrained.size();
+
+    std::vector<Uint32> depths;
+
+    if( inside )
+    {
+        // Crossing a forced edge goes one loop deeper, starting from the ghost triangles
+        depths.assign(trianglesCount, None);
+
+        std::vector<Uint32> current, next;
+
+        for( Uint32 k(0); k < trianglesCount; k++ )
+        {
+            if( m_vertices[k * 3] == 0 || m_vertices[k * 3 + 1] == 0 || m_vertices[k * 3 + 2] == 0 )
+            {
+                depths[k] = 0;
+                current.push_back(k);
+            }
+        }
+
+        for( Uint32 depth(0); !current.empty(); depth++ )
+        {
+            while( !current.empty() )
+            {
+                Uint32 triangle = current.back();
+                current.pop_back();
+
+                for( Uint32 i(0); i < 3; i++ )
+                {
+                    Uint32 neighbour = m_neighbours[triangle * 3 + i];
+
+                    if( neighbour == None || depths[neighbour] != None )
+                        continue;
+
+                    if( m_constrained[triangle] & (1 << i) )
+                        next.push_back(neighbour);
+
+                    else
+                    {
+                        depths[neighbour] = depth;
+                        current.push_back(neighbour);
+                    }
+                }
+            }
+
+            for( auto& triangle : next )
+            {
+                if( depths[triangle] == None )
+                {
+                    depths[triangle] = depth + 1;
+                    current.push_back(triangle);
+                }
+            }
+
+            next.clear();
+        }
+    }
+
+    for( Uint32 k(0); k < trianglesCount; k++ )
+    {
+        const Uint32* vertices = &m_vertices[k * 3];
+
+        if( vertices[0] == 0 || vertices[1] == 0 || vertices[2] == 0 )
+            continue;
+
+        if( inside && depths[k] % 2 == 0 )
+            continue;
+
+        triangles.push_back(vertices[0] - 1);
+        triangles.push_back(vertices[1] - 1);
+        triangles.push_back(vertices[2] - 1);
+    }
+}
+
+////////////////////////////////////////////////////////////
+void Delaunay::clear()
+{
+    m_points.clear();
+    m_aliases.clear();
+    m_vertexTriangles.clear();
+    m_vertices.clear();
+    m_neighbours.clear();
+    m_constrained.clear();
+    m_stack.clear();
+    m_last = 0;
+    m_walks = 0;
+}
+
+////////////////////////////////////////////////////////////
+Uint32 Delaunay::addTriangle()
+{
+    m_vertices.resize(m_vertices.size() + 3, None);
+    m_neighbours.resize(m_neighbours.size() + 3, None);
+    m_constrained.push_back(0);
+
+    return m_constrained.size() - 1;
+}
+
+////////////////////////////////////////////////////////////
+Uint32 Delaunay::insert(Uint32 vertex)
+{
+    Location location;
+    Uint32 indice;
+    Uint32 triangle = locate(m_points[vertex], location, indice);
+
+    if( location == OnVertex )
+        return m_vertices[triangle * 3 + indice];
+
+    if( location == Inside )
+    {
+        splitTriangle(triangle, vertex);
+        m_stack.push_back(triangle);
+        m_stack.push_back(m_constrained.size() - 2);
+        m_stack.push_back(m_constrained.size() - 1);
+    }
+
+    else
+    {
+        Uint32 neighbour = m_neighbours[triangle * 3 + indice];
+
+        splitEdge(triangle, indice, vertex);
+        m_stack.push_back(triangle);
+        m_stack.push_back(neighbour);
+        m_stack.push_back(m_constrained.size() - 2);
+        m_stack.push_back(m_constrained.size() - 1);
+    }
+
+    legalize(m_stack);
+
+    return vertex;
+}
+
+////////////////////////////////////////////////////////////
+Uint32 Delaunay::locate(const Point& point, Location& location, Uint32& indice)
+{
+    Uint32 triangle = m_last;
+    location = Inside;
+
+    // The first edge tested changes from a walk to another, so the walk can not loop
+    for( Uint32 steps(0); steps < m_constrained.size() * 3; steps++ )
+    {
+        const Uint32* vertices = &m_vertices[triangle * 3];
+        Uint32 next = None;
+
+        if( vertices[0] == 0 || vertices[1] == 0 || vertices[2] == 0 )
+        {
+            // Beyond its hull edge, the point is found in a ghost triangle
+            Uint32 k = vertices[0] == 0 ? 0 : vertices[1] == 0 ? 1 : 2;
+            const Point& p = m_points[vertices[(k + 1) % 3]], & q = m_points[vertices[(k + 2) % 3]];
+            double side = orientation(p, q, point);
+
+            if( side < 0 )
+                next = m_neighbours[triangle * 3 + k];
+
+            else if( side == 0 )
+            {
+                double t = (point - p).x * (q - p).x + (point - p).y * (q - p).y,
+                       length = (q - p).x * (q - p).x + (q - p).y * (q - p).y;
+
+                if( t < 0 )
+                    next = m_neighbours[triangle * 3 + (k + 2) % 3];
+
+                else if( t > length )
+                    next = m_neighbours[triangle * 3 + (k + 1) % 3];
+
+                else
+                {
+                    location = OnEdge;
+                    indice = k;
+                }
+            }
+        }
+
+        else
+        {
+            Uint32 start = m_walks++ % 3;
+
+            for( Uint32 k(0); k < 3; k++ )
+            {
+                Uint32 i = (start + k) % 3;
+
+                if( orientation(m_points[vertices[(i + 1) % 3]], m_points[vertices[(i + 2) % 3]], point) < 0 )
+                {
+                    next = m_neighbours[triangle * 3 + i];
+                    break;
+                }
+            }
+
+            if( next == None )
+            {
+                for( Uint32 i(0); i < 3; i++ )
+                {
+                    if( orientation(m_points[vertices[(i + 1) % 3]], m_points[vertices[(i + 2) % 3]], point) == 0 )
+                    {
+                        location = OnEdge;
+                        indice = i;
+                    }
+                }
+            }
+        }
+
+        if( next == None )
+            break;
+
+        triangle = next;
+    }
+
+    m_last = triangle;
+
+    for( Uint32 i(0); i < 3; i++ )
+    {
+        Uint32 vertex = m_vertices[triangle * 3 + i];
+
+        if( vertex != 0 && m_points[vertex] == point )
+        {
+            location = OnVertex;
+            indice = i;
+        }
+    }
+
+    return triangle;
+}
+
+////////////////////////////////////////////////////////////
+void Delaunay::splitTriangle(Uint32 triangle, Uint32 vertex)
+{
+    Uint32 triangle1 = addTriangle(), triangle2 = addTriangle();
+
+    Uint32* vertices = &m_vertices[triangle * 3];
+    Uint32 a = vertices[0], b = vertices[1], c = vertices[2];
+    Uint32 neighbourA = m_neighbours[triangle * 3],
+           neighbourB = m_neighbours[triangle * 3 + 1],
+           neighbourC = m_neighbours[triangle * 3 + 2];
+    Uint8 constrained = m_constrained[triangle];
+
+    // The new vertex goes first in each triangle, facing an edge of the old one
+    Uint32 values[3][7] =
+    {
+        {triangle,  b, c, neighbourA, triangle1, triangle2, Uint32(constrained & 1)},
+        {triangle1, c, a, neighbourB, triangle2, triangle,  Uint32((constrained >> 1) & 1)},
+        {triangle2, a, b, neighbourC, triangle,  triangle1, Uint32((constrained >> 2) & 1)}
+    };
+
+    for( auto& value : values )
+    {
+        m_vertices[value[0] * 3] = vertex;
+        m_vertices[value[0] * 3 + 1] = value[1];
+        m_vertices[value[0] * 3 + 2] = value[2];
+        m_neighbours[value[0] * 3] = value[3];
+        m_neighbours[value[0] * 3 + 1] = value[4];
+        m_neighbours[value[0] * 3 + 2] = value[5];
+        m_constrained[value[0]] = value[6];
+    }
+
+    replaceNeighbour(neighbourB, triangle, triangle1);
+    replaceNeighbour(neighbourC, triangle, triangle2);
+
+    m_vertexTriangles[vertex] = triangle;
+    m_vertexTriangles[a] = triangle1;
+    m_vertexTriangles[b] = triangle;
+    m_vertexTriangles[c] = triangle;
+}
+
+////////////////////////////////////////////////////////////
+void Delaunay::splitEdge(Uint32 triangle, Uint32 indice, Uint32 vertex)
+{
+    Uint32 neighbour = m_neighbours[triangle * 3 + indice];
+    Uint32 opposite = getOpposite(neighbour, triangle);
+
+    Uint32 a = m_vertices[triangle * 3 + indice],
+           b = m_vertices[triangle * 3 + (indice + 1) % 3],
+           c = m_vertices[triangle * 3 + (indice + 2) % 3],
+           d = m_vertices[neighbour * 3 + opposite];
+
+    Uint32 neighbourB = m_neighbours[triangle * 3 + (indice + 1) % 3],
+           neighbourC = m_neighbours[triangle * 3 + (indice + 2) % 3],
+           neighbourUB = m_neighbours[neighbour * 3 + (opposite + 2) % 3],
+           neighbourUC = m_neighbours[neighbour * 3 + (opposite + 1) % 3];
+
+    Uint32 constrainedB = (m_constrained[triangle] >> ((indice + 1) % 3)) & 1,
+           constrainedC = (m_constrained[triangle] >> ((indice + 2) % 3)) & 1,
+           constrainedUB = (m_constrained[neighbour] >> ((opposite + 2) % 3)) & 1,
+           constrainedUC = (m_constrained[neighbour] >> ((opposite + 1) % 3)) & 1,
+           split = (m_constrained[triangle] >> indice) & 1;
+
+    Uint32 triangle1 = addTriangle(), neighbour1 = addTriangle();
+
+    // A forced edge stays forced on both halves
+    Uint32 values[4][7] =
+    {
+        {triangle,   a, b, neighbourC,  neighbour,  triangle1,  constrainedC  | split << 1},
+        {triangle1,  c, a, neighbourB,  triangle,   neighbour1, constrainedB  | split << 2},
+        {neighbour,  b, d, neighbourUC, neighbour1, triangle,   constrainedUC | split << 2},
+        {neighbour1, d, c, neighbourUB, triangle1,  neighbour,  constrainedUB | split << 1}
+    };
+
+    for( auto& value : values )
+    {
+        m_vertices[value[0] * 3] = vertex;
+        m_vertices[value[0] * 3 + 1] = value[1];
+        m_vertices[value[0] * 3 + 2] = value[2];
+        m_neighbours[value[0] * 3] = value[3];
+        m_neighbours[value[0] * 3 + 1] = value[4];
+        m_neighbours[value[0] * 3 + 2] = value[5];
+        m_constrained[value[0]] = value[6];
+    }
+
+    replaceNeighbour(neighbourB, triangle, triangle1);
+    replaceNeighbour(neighbourUB, neighbour, neighbour1);
+
+    m_vertexTriangles[vertex] = triangle;
+    m_vertexTriangles[a] = triangle;
+    m_vertexTriangles[b] = triangle;
+    m_vertexTriangles[c] = triangle1;
+    m_vertexTriangles[d] = neighbour;
+}
+
+////////////////////////////////////////////////////////////
+void Delaunay::legalize(std::vector<Uint32>& triangles)
+{
+    // Each triangle of the stack has the new vertex first, facing the edge to check
+    while( !triangles.empty() )
+    {
+        Uint32 triangle = triangles.back();
+        triangles.pop_back();
+
+        Uint32 neighbour = m_neighbours[triangle * 3];
+
+        if( neighbour == None || (m_constrained[triangle] & 1) )
+            continue;
+
+        Uint32 opposite = m_vertices[neighbour * 3 + getOpposite(neighbour, triangle)];
+
+        if( isInCircle(triangle, opposite) )
+        {
+            flip(triangle, 0);
+            triangles.push_back(triangle);
+            triangles.push_back(neighbour);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////
+void Delaunay::flip(Uint32 triangle, Uint32 indice)
+{
+    Uint32 neighbour = m_neighbours[triangle * 3 + indice];
+    Uint32 opposite = getOpposite(neighbour, triangle);
+
+    Uint32 v0 = m_vertices[triangle * 3 + indice],
+           v1 = m_vertices[triangle * 3 + (indice + 1) % 3],
+           v2 = m_vertices[triangle * 3 + (indice + 2) % 3],
+           w  = m_vertices[neighbour * 3 + opposite];
+
+    Uint32 neighbourA = m_neighbours[triangle * 3 + (indice + 1) % 3],
+           neighbourB = m_neighbours[triangle * 3 + (indice + 2) % 3],
+           neighbourUA = m_neighbours[neighbour * 3 + (opposite + 1) % 3],
+           neighbourUB = m_neighbours[neighbour * 3 + (opposite + 2) % 3];
+
+    Uint32 constrainedA = (m_constrained[triangle] >> ((indice + 1) % 3)) & 1,
+           constrainedB = (m_constrained[triangle] >> ((indice + 2) % 3)) & 1,
+           constrainedUA = (m_constrained[neighbour] >> ((opposite + 1) % 3)) & 1,
+           constrainedUB = (m_constrained[neighbour] >> ((opposite + 2) % 3)) & 1;
+
+    // The new edge joins the first vertex to the opposite one
+    m_vertices[triangle * 3] = v0;
+    m_vertices[triangle * 3 + 1] = v1;
+    m_vertices[triangle * 3 + 2] = w;
+    m_neighbours[triangle * 3] = neighbourUA;
+    m_neighbours[triangle * 3 + 1] = neighbour;
+    m_neighbours[triangle * 3 + 2] = neighbourB;
+    m_constrained[triangle] = constrainedUA | constrainedB << 2;
+
+    m_vertices[neighbour * 3] = v0;
+    m_vertices[neighbour * 3 + 1] = w;
+    m_vertices[neighbour * 3 + 2] = v2;
+    m_neighbours[neighbour * 3] = neighbourUB;
+    m_neighbours[neighbour * 3 + 1] = neighbourA;
+    m_neighbours[neighbour * 3 + 2] = triangle;
+    m_constrained[neighbour] = constrainedUB | constrainedA << 1;
+
+    replaceNeighbour(neighbourUA, neighbour, triangle);
+    replaceNeighbour(neighbourA, triangle, neighbour);
+
+    m_vertexTriangles[v0] = triangle;
+    m_vertexTriangles[v1] = triangle;
+    m_vertexTriangles[v2] = neighbour;
+    m_vertexTriangles[w] = neighbour;
+}
+
+////////////////////////////////////////////////////////////
+bool Delaunay::findEdge(Uint32 vertex1, Uint32 vertex2, Uint32& triangle, Uint32& indice) const
+{
+    Uint32 start = m_vertexTriangles[vertex1], current = start;
+
+    // Turn around the first vertex
+    do
+    {
+        const Uint32* vertices = &m_vertices[current * 3];
+        Uint32 k = vertices[0] == vertex1 ? 0 : vertices[1] == vertex1 ? 1 : 2;
+
+        if( vertices[(k + 1) % 3] == vertex2 )
+        {
+            triangle = current;
+            indice = (k + 2) % 3;
+
+            return true;
+        }
+
+        if( vertices[(k + 2) % 3] == vertex2 )
+        {
+            triangle = current;
+            indice = (k + 1) % 3;
+
+            return true;
+        }
+
+        current = m_neighbours[current * 3 + (k + 1) % 3];
+    }
+    while( current != start && current != None );
+
+    return false;
+}
+
+////////////////////////////////////////////////////////////
+Uint32 Delaunay::constrainEdge(Uint32 vertex1, Uint32 vertex2)
+{
+    Uint32 triangle, indice;
+
+    if( findEdge(vertex1, vertex2, triangle, indice) )
+    {
+        setConstrained(triangle, indice);
+
+        return vertex2;
+    }
+
+    const Point& a = m_points[vertex1], & b = m_points[vertex2];
+
+    // Find the triangle around the first vertex where the edge leaves, between a right & a left vertex
+    Uint32 start = m_vertexTriangles[vertex1], current = start, right = None, left = None;
+
+    do
+    {
+        const Uint32* vertices = &m_vertices[current * 3];
+        Uint32 k = vertices[0] == vertex1 ? 0 : vertices[1] == vertex1 ? 1 : 2;
+        Uint32 p = vertices[(k + 1) % 3], q = vertices[(k + 2) % 3];
+
+        // The edge stays inside the hull, away from the ghost triangles
+        if( p == 0 || q == 0 )
+        {
+            current = m_neighbours[current * 3 + (k + 1) % 3];
+            continue;
+        }
+
+        double sideP = orientation(a, b, m_points[p]), sideQ = orientation(a, b, m_points[q]);
+
+        // A vertex lying on the edge splits it
+        if( sideP == 0 && (m_points[p] - a).x * (b - a).x + (m_points[p] - a).y * (b - a).y > 0 )
+        {
+            setConstrained(current, (k + 2) % 3);
+
+            return p;
+        }
+
+        if( sideQ == 0 && (m_points[q] - a).x * (b - a).x + (m_points[q] - a).y * (b - a).y > 0 )
+        {
+            setConstrained(current, (k + 1) % 3);
+
+            return q;
+        }
+
+        if( sideP < 0 && sideQ > 0 )
+        {
+            triangle = current;
+            indice = k;
+            right = p;
+            left = q;
+            break;
+        }
+
+        current = m_neighbours[current * 3 + (k + 1) % 3];
+    }
+    while( current != start && current != None );
+
+    if( right == None )
+        return None;
+
+    // Walk along the edge, gathering the crossed edges
+    std::vector<std::pair<Uint32, Uint32>> crossed;
+    Uint32 reached = None;
+
+    while( reached == None )
+    {
+        if( m_constrained[triangle] & (1 << indice) )
+            return None;
+
+        crossed.push_back(std::make_pair(right, left));
+
+        Uint32 neighbour = m_neighbours[triangle * 3 + indice];
+        Uint32 opposite = getOpposite(neighbour, triangle);
+        Uint32 w = m_vertices[neighbour * 3 + opposite];
+        double side = orientation(a, b, m_points[w]);
+
+        if( w == vertex2 || side == 0 )
+            reached = w;
+
+        else
+        {
+            // Leave through the edge facing the right or the left vertex
+            Uint32 facing = side < 0 ? right : left;
+            triangle = neighbour;
+            indice = m_vertices[neighbour * 3] == facing ? 0 : m_vertices[neighbour * 3 + 1] == facing ? 1 : 2;
+
+            if( side < 0 )
+                right = w;
+
+            else left = w;
+        }
+    }
+
+    const Point& c = m_points[reached];
+
+    auto crosses = [&](Uint32 vertex3, Uint32 vertex4)
+    {
+        const Point& p = m_points[vertex3], & q = m_points[vertex4];
+
+        return orientation(a, c, p) * orientation(a, c, q) < 0 && orientation(p, q, a) * orientation(p, q, c) < 0;
+    };
+
+    // Flip the crossed edges away, the ones in a concave quad are retried later
+    std::vector<std::pair<Uint32, Uint32>> created;
+
+    for( size_t k(0); k < crossed.size(); k++ )
+    {
+        std::pair<Uint32, Uint32> edge = crossed[k];
+        Uint32 p = edge.first, q = edge.second;
+
+        if( !findEdge(p, q, triangle, indice) )
+            continue;
+
+        Uint32 neighbour = m_neighbours[triangle * 3 + indice];
+        Uint32 v0 = m_vertices[triangle * 3 + indice], w = m_vertices[neighbour * 3 + getOpposite(neighbour, triangle)];
+
+        if( orientation(m_points[v0], m_points[w], m_points[p]) * orientation(m_points[v0], m_points[w], m_points[q]) >= 0 )
+        {
+            crossed.push_back(edge);
+            continue;
+        }
+
+        flip(triangle, indice);
+
+        if( crosses(v0, w) )
+            crossed.push_back(std::make_pair(v0, w));
+
+        else created.push_back(std::make_pair(v0, w));
+    }
+
+    if( findEdge(vertex1, reached, triangle, indice) )
+        setConstrained(triangle, indice);
+
+    // Restore the Delaunay property around the new edges
+    for( bool flipped(true); flipped; )
+    {
+        flipped = false;
+
+        for( auto& edge : created )
+        {
+            if( (edge.first == vertex1 && edge.second == reached) || (edge.first == reached && edge.second == vertex1) )
+                continue;
+
+            if( !findEdge(edge.first, edge.second, triangle, indice) || (m_constrained[triangle] & (1 << indice)) )
+                continue;
+
+            Uint32 neighbour = m_neighbours[triangle * 3 + indice];
+            Uint32 v0 = m_vertices[triangle * 3 + indice], w = m_vertices[neighbour * 3 + getOpposite(neighbour, triangle)];
+
+            if( isInCircle(triangle, w) )
+            {
+                flip(triangle, indice);
+                edge = std::make_pair(v0, w);
+                flipped = true;
+            }
+        }
+    }
+
+    return reached;
+}
+
+////////////////////////////////////////////////////////////
+void Delaunay::setConstrained(Uint32 triangle, Uint32 indice)
+{
+    m_constrained[triangle] |= 1 << indice;
+
+    Uint32 neighbour = m_neighbours[triangle * 3 + indice];
+
+    if( neighbour != None )
+        m_constrained[neighbour] |= 1 << getOpposite(neighbour, triangle);
+}
+
+////////////////////////////////////////////////////////////
+void Delaunay::replaceNeighbour(Uint32 triangle, Uint32 oldNeighbour, Uint32 newNeighbour)
+{
+    if( triangle == None )
+        return;
+
+    for( Uint32 k(0); k < 3; k++ )
+    {
+        if( m_neighbours[triangle * 3 + k] == oldNeighbour )
+        {
+            m_neighbours[triangle * 3 + k] = newNeighbour;
+            return;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////
+Uint32 Delaunay::getOpposite(Uint32 triangle, Uint32 neighbour) const
+{
+    return m_neighbours[triangle * 3] == neighbour ? 0 : m_neighbours[triangle * 3 + 1] == neighbour ? 1 : 2;
+}
+
+////////////////////////////////////////////////////////////
+bool Delaunay::isInCircle(Uint32 triangle, Uint32 vertex) const
+{
+    if( vertex == 0 )
+        return false;
+
+    const Uint32* vertices = &m_vertices[triangle * 3];
+
+    // For a ghost triangle, the circle becomes the half plane beyond its hull edge, with the edge itself
+    if( vertices[0] == 0 || vertices[1] == 0 || vertices[2] == 0 )
+    {
+        Uint32 k = vertices[0] == 0 ? 0 : vertices[1] == 0 ? 1 : 2;
+        const Point& p = m_points[vertices[(k + 1) % 3]], & q = m_points[vertices[(k + 2) % 3]], & point = m_points[vertex];
+        double side = orientation(p, q, point);
+
+        if( side != 0 )
+            return side > 0;
+
+        double t = (point - p).x * (q - p).x + (point - p).y * (q - p).y;
+
+        return t > 0 && t < (q - p).x * (q - p).x + (q - p).y * (q - p).y;
+    }
+
+    return inCircle(m_points[vertices[0]], m_points[vertices[1]], m_points[vertices[2]], m_points[vertex]) > 0;
+}
+
+////////////////////////////////////////////////////////////
+double Delaunay::orientation(const Point& point1, const Point& point2, const Point& point3)
+{
+    double left = (point1.x - point3.x) * (point2.y - point3.y),
+           right = (point1.y - point3.y) * (point2.x - point3.x),
+           result = left - right;
+
+    // Close to zero, the rounding errors may change the sign, so it is computed again with more precision
+    if( Math::abs(result) >= 3.3306690738754716e-16 * (Math::abs(left) + Math::abs(right)) )
+        return result;
+
+    long double x1 = point1.x, y1 = point1.y, x2 = point2.x, y2 = point2.y, x3 = point3.x, y3 = point3.y;
+
+    return double((x1 - x3) * (y2 - y3) - (y1 - y3) * (x2 - x3));
+}
+
+////////////////////////////////////////////////////////////
+double Delaunay::inCircle(const Point& point1, const Point& point2, const Point& point3, const Point& point)
+{
+    double x1 = point1.x - point.x, y1 = point1.y - point.y,
+           x2 = point2.x - point.x, y2 = point2.y - point.y,
+           x3 = point3.x - point.x, y3 = point3.y - point.y;
+
+    double x2y3 = x2 * y3, x3y2 = x3 * y2,
+           x3y1 = x3 * y1, x1y3 = x1 * y3,
+           x1y2 = x1 * y2, x2y1 = x2 * y1;
+
+    double lift1 = x1 * x1 + y1 * y1, lift2 = x2 * x2 + y2 * y2, lift3 = x3 * x3 + y3 * y3;
+
+    double result = lift1 * (x2y3 - x3y2) + lift2 * (x3y1 - x1y3) + lift3 * (x1y2 - x2y1),
+           bound = (Math::abs(x2y3) + Math::abs(x3y2)) * lift1 +
+                   (Math::abs(x3y1) + Math::abs(x1y3)) * lift2 +
+                   (Math::abs(x1y2) + Math::abs(x2y1)) * lift3;
+
+    if( Math::abs(result) >= 1.1102230246251577e-15 * bound )
+        return result;
+
+    long double X1 = (long double)point1.x - point.x, Y1 = (long double)point1.y - point.y,
+                X2 = (long double)point2.x - point.x, Y2 = (long double)point2.y - point.y,
+                X3 = (long double)point3.x - point.x, Y3 = (long double)point3.y - point.y;
+
+    return double((X1 * X1 + Y1 * Y1) * (X2 * Y3 - X3 * Y2) +
+                  (X2 * X2 + Y2 * Y2) * (X3 * Y1 - X1 * Y3) +
+                  (X3 * X3 + Y3 * Y3) * (X1 * Y2 - X2 * Y1));
+}
+
+////////////////////////////////////////////////////////////
+Uint32 Delaunay::hilbert(Uint32 x, Uint32 y)
+{
+    Uint32 distance(0);
+
+    for( Uint32 s(1 << 15); s > 0; s >>= 1 )
+    {
+        Uint32 rx = (x & s) > 0, ry = (y & s) > 0;
+        distance+=s * s * ((3 * rx) ^ ry);
+
+        // Rotate the quadrant
+        if( ry == 0 )
+        {
+            if( rx == 1 )
+            {
+                x = 65535 - x;
+                y = 65535 - y;
+            }
+
+            std::swap(x, y);
+        }
+    }
+
+    return distance;
+}
+
+}
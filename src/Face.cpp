@@ -29,16 +29,23 @@ namespace zin
 {
 
 ////////////////////////////////////////////////////////////
-Face::Face(const Vertex& vertex1, const Vertex& vertex2, const Vertex& vertex3, const Geom& geom) :
+Face::Face(const Vertex& vertex1, const Vertex& vertex2, const Vertex& vertex3, size_t indice, const Geom& geom) :
 v1(vertex1),
 v2(vertex2),
 v3(vertex3),
-m_geom(geom) {}
+m_geom(&geom),
+m_indice(indice) {}
 
 ////////////////////////////////////////////////////////////
 Triangle Face::getTriangle()
 {
-    return Triangle(m_geom.convertToGlobal(v1.getCoords()), m_geom.convertToGlobal(v2.getCoords()), m_geom.convertToGlobal(v3.getCoords()));
+    return Triangle(m_geom->convertToGlobal(v1.getCoords()), m_geom->convertToGlobal(v2.getCoords()), m_geom->convertToGlobal(v3.getCoords()));
+}
+
+////////////////////////////////////////////////////////////
+size_t Face::getIndice() const
+{
+    return m_indice;
 }
 
 }
\ No newline at end of file
@@ -24,6 +24,10 @@
 
 #include <Zoost/Geom.hpp>
 #include <Zoost/Converter.hpp>
+#include <Zoost/Triangulation.hpp>
+#include <Zoost/Delaunay.hpp>
+#include <algorithm>
+#include <utility>
 
 namespace zin
 {
@@ -39,9 +43,20 @@ Transformable(geom)
     add(geom);
 }
 
+////////////////////////////////////////////////////////////
+Geom::Geom(Geom&& geom) :
+Transformable(geom)
+{
+    swapElements(geom);
+    geom.clear();
+}
+
 ////////////////////////////////////////////////////////////
 Geom& Geom::operator=(const Geom& geom)
 {
+    if( &geom == this )
+        return *this;
+
     Transformable::operator=(geom);
     
     clear();
@@ -50,6 +65,29 @@ Geom& Geom::operator=(const Geom& geom)
     return *this;
 }
 
+////////////////////////////////////////////////////////////
+Geom& Geom::operator=(Geom&& geom)
+{
+    if( &geom == this )
+        return *this;
+
+    Transformable::operator=(geom);
+
+    clear();
+    beginEdit();
+
+    swapElements(geom);
+    geom.clear();
+
+    extend(m_changes.vertices, 0, m_vertices.size());
+    extend(m_changes.liaisons, 0, m_liaisons.size());
+    extend(m_changes.faces, 0, m_faces.size());
+
+    endEdit();
+
+    return *this;
+}
+
 ////////////////////////////////////////////////////////////
 Geom::~Geom()
 {
@@ -68,50 +106,134 @@ void Geom::removeObserver(Observer& observer)
     m_observers.erase(&observer);
 }
 
+////////////////////////////////////////////////////////////
+void Geom::beginEdit()
+{
+    if( m_editDepth++ == 0 )
+        m_changes = Changes{Range{0, 0}, Range{0, 0}, Range{0, 0}, m_vertices.size(), m_liaisons.size(), m_faces.size()};
+}
+
+////////////////////////////////////////////////////////////
+void Geom::endEdit()
+{
+    if( m_editDepth == 0 || --m_editDepth > 0 )
+        return;
+
+    // The removals may have left the ranges beyond the ends
+    m_changes.vertices.end = std::min(m_changes.vertices.end, m_vertices.size());
+    m_changes.liaisons.end = std::min(m_changes.liaisons.end, m_liaisons.size());
+    m_changes.faces.end    = std::min(m_changes.faces.end, m_faces.size());
+
+    bool changed = m_changes.vertices.begin < m_changes.vertices.end || m_changes.verticesCount != m_vertices.size() ||
+                   m_changes.liaisons.begin < m_changes.liaisons.end || m_changes.liaisonsCount != m_liaisons.size() ||
+                   m_changes.faces.begin < m_changes.faces.end || m_changes.facesCount != m_faces.size();
+
+    if( changed )
+    {
+        for( auto& observer : m_observers )
+            observer->onEdited(m_changes);
+    }
+}
+
+////////////////////////////////////////////////////////////
+bool Geom::isEditing() const
+{
+    return m_editDepth > 0;
+}
+
+////////////////////////////////////////////////////////////
+Geom::Edit::Edit(Geom& geom) :
+m_geom(geom)
+{
+    m_geom.beginEdit();
+}
+
+////////////////////////////////////////////////////////////
+Geom::Edit::~Edit()
+{
+    m_geom.endEdit();
+}
+
 ////////////////////////////////////////////////////////////
 void Geom::clear()
 {
     for( auto& vertex : m_vertices )
-        delete vertex;
+        vertex->~Vertex();
 
     m_vertices.clear();
+    m_coordsX.clear();
+    m_coordsY.clear();
+    m_vertexPool.reset();
 
     for( auto& liaison : m_liaisons )
-        delete liaison;
+        liaison->~Liaison();
 
     m_liaisons.clear();
+    m_liaisonPool.reset();
+    m_liaisonTreeUpdated = false;
 
     for( auto& face : m_faces )
-        delete face;
+        face->~Face();
 
     m_faces.clear();
+    m_facePool.reset();
+    m_faceTreeUpdated = false;
 
     for( auto& observer : m_observers )
         observer->onErasing();
 
+    // The observers know the geom is empty, the running edit starts over from here
+    if( m_editDepth > 0 )
+        m_changes = Changes{Range{0, 0}, Range{0, 0}, Range{0, 0}, 0, 0, 0};
+
     m_localBoundsUpdated = false;
+    m_globalBoundsUpdated = false;
 }
 
 ////////////////////////////////////////////////////////////
 Geom& Geom::add(const Geom& geom)
 {
-    size_t offset = getVerticesCount();
+    size_t offset = getVerticesCount(),
+           verticesCount = geom.getVerticesCount(),
+           liaisonsCount = geom.getLiaisonsCount(),
+           facesCount = geom.getFacesCount();
 
-    for( auto& vertex : geom.m_vertices )
-        addVertex(convertToLocal(geom.convertToGlobal(vertex->getCoords())));
+    std::vector<Coords> coords(verticesCount);
+
+    Edit edit(*this);
+
+    m_coordsX.reserve(offset + verticesCount);
+    m_coordsY.reserve(offset + verticesCount);
+    m_vertices.reserve(offset + verticesCount);
+    m_liaisons.reserve(getLiaisonsCount() + liaisonsCount);
+    m_faces.reserve(getFacesCount() + facesCount);
+
+    for( size_t k(0); k < verticesCount; k++ )
+        coords[k] = Coords(geom.m_coordsX[k], geom.m_coordsY[k]);
+
+    // From the other local space to this one in a single pass, copies sharing the same transform are kept exact
+    if( getTransform() != geom.getTransform() )
+        (getInvTransform() * geom.getTransform()).getMultiplication(coords, coords);
+
+    // Plain vertices, a derived geom linking its own would duplicate the copied liaisons
+    for( size_t k(0); k < verticesCount; k++ )
+        Geom::addVertex(coords[k]);
     
-    for( auto& liaison : geom.m_liaisons )
-        addLiaison(getVertex(liaison->v1.getIndice() + offset), getVertex(liaison->v2.getIndice() + offset));
+    for( size_t k(0); k < liaisonsCount; k++ )
+    {
+        const Liaison& liaison = *geom.m_liaisons[k];
+        addLiaison(getVertex(liaison.v1.getIndice() + offset), getVertex(liaison.v2.getIndice() + offset));
+    }
 
-    for( auto& face : geom.m_faces )
-        addFace(getVertex(face->v1.getIndice() + offset), getVertex(face->v2.getIndice() + offset), getVertex(face->v3.getIndice() + offset));
+    for( size_t k(0); k < facesCount; k++ )
+    {
+        const Face& face = *geom.m_faces[k];
+        addFace(getVertex(face.v1.getIndice() + offset), getVertex(face.v2.getIndice() + offset), getVertex(face.v3.getIndice() + offset));
+    }
 
     m_localBoundsUpdated = false;
     m_globalBoundsUpdated = false;
 
-    for( auto& observer : geom.m_observers )
-        m_observers.insert(observer);
-
     return *this;
 }
 
@@ -119,7 +241,9 @@ Geom& Geom::add(const Geom& geom)
 Geom Geom::operator+(const Geom& geom)
 {
     Geom copy = *this;
-    return copy.add(geom);
+    copy.add(geom);
+
+    return copy;
 }
 
 ////////////////////////////////////////////////////////////
@@ -131,14 +255,22 @@ Geom& Geom::operator+=(const Geom& geom)
 ////////////////////////////////////////////////////////////
 Vertex& Geom::addVertex(const Coords& coords)
 {
-    Vertex* vertex = new Vertex(coords, *this);
+    Vertex* vertex = new (m_vertexPool.allocate()) Vertex(m_coordsX.size(), *this);
     m_vertices.push_back(vertex);
+    m_coordsX.push_back(coords.x);
+    m_coordsY.push_back(coords.y);
 
     m_localBoundsUpdated = false;
     m_globalBoundsUpdated = false;
 
-    for( auto& observer : m_observers )
-        observer->onVertexAdded();
+    if( m_editDepth > 0 )
+        extend(m_changes.vertices, vertex->m_indice, vertex->m_indice + 1);
+
+    else
+    {
+        for( auto& observer : m_observers )
+            observer->onVertexAdded();
+    }
     
     return *vertex;
 }
@@ -146,11 +278,18 @@ Vertex& Geom::addVertex(const Coords& coords)
 ////////////////////////////////////////////////////////////
 Liaison& Geom::addLiaison(const Vertex& vertex1, const Vertex& vertex2)
 {
-    Liaison* liaison = new Liaison(vertex1, vertex2, *this);
+    Liaison* liaison = new (m_liaisonPool.allocate()) Liaison(vertex1, vertex2, m_liaisons.size(), *this);
     m_liaisons.push_back(liaison);
+    m_liaisonTreeUpdated = false;
 
-    for( auto& observer : m_observers )
-        observer->onLiaisonAdded();
+    if( m_editDepth > 0 )
+        extend(m_changes.liaisons, liaison->m_indice, liaison->m_indice + 1);
+
+    else
+    {
+        for( auto& observer : m_observers )
+            observer->onLiaisonAdded();
+    }
     
     return *liaison;
 }
@@ -158,11 +297,18 @@ Liaison& Geom::addLiaison(const Vertex& vertex1, const Vertex& vertex2)
 ////////////////////////////////////////////////////////////
 Face& Geom::addFace(const Vertex& vertex1, const Vertex& vertex2, const Vertex& vertex3)
 {
-    Face* face = new Face(vertex1, vertex2, vertex3, *this);
+    Face* face = new (m_facePool.allocate()) Face(vertex1, vertex2, vertex3, m_faces.size(), *this);
     m_faces.push_back(face);
+    m_faceTreeUpdated = false;
 
-    for( auto& observer : m_observers )
-        observer->onFaceAdded();
+    if( m_editDepth > 0 )
+        extend(m_changes.faces, face->m_indice, face->m_indice + 1);
+
+    else
+    {
+        for( auto& observer : m_observers )
+            observer->onFaceAdded();
+    }
     
     return *face;
 }
@@ -170,80 +316,306 @@ Face& Geom::addFace(const Vertex& vertex1, const Vertex& vertex2, const Vertex&
 ////////////////////////////////////////////////////////////
 void Geom::removeVertex(const Vertex& vertex)
 {
-    for( size_t k(0); k < m_liaisons.size(); )
+    removeVertices(vertex.getIndice(), vertex.getIndice() + 1);
+}
+
+////////////////////////////////////////////////////////////
+void Geom::removeLiaison(const Liaison& liaison)
+{
+    size_t indice = liaison.getIndice();
+
+    m_liaisons[indice]->~Liaison();
+    m_liaisonPool.release(m_liaisons[indice]);
+    m_liaisons.erase(m_liaisons.begin() + indice);
+
+    for( size_t k(indice); k < m_liaisons.size(); k++ )
+        m_liaisons[k]->m_indice = k;
+
+    m_liaisonTreeUpdated = false;
+
+    if( m_editDepth > 0 )
+        extend(m_changes.liaisons, indice, m_liaisons.size());
+
+    else
     {
-        if( &(m_liaisons[k]->v1) == &vertex || &(m_liaisons[k]->v2) == &vertex )
-        {
-            delete m_liaisons[k];
-            m_liaisons.erase(m_liaisons.begin() + k);
+        for( auto& observer : m_observers )
+            observer->onLiaisonRemoved(indice);
+    }
 
-            for( auto& observer : m_observers )
-                observer->onLiaisonRemoved(k);
-        }
+    onElementsRemoved();
+}
+
+////////////////////////////////////////////////////////////
+void Geom::removeFace(const Face& face)
+{
+    size_t indice = face.getIndice();
+
+    m_faces[indice]->~Face();
+    m_facePool.release(m_faces[indice]);
+    m_faces.erase(m_faces.begin() + indice);
+
+    for( size_t k(indice); k < m_faces.size(); k++ )
+        m_faces[k]->m_indice = k;
 
-        else k++;
+    m_faceTreeUpdated = false;
+
+    if( m_editDepth > 0 )
+        extend(m_changes.faces, indice, m_faces.size());
+
+    else
+    {
+        for( auto& observer : m_observers )
+            observer->onFaceRemoved(indice);
     }
 
-    for( size_t k(0); k < m_faces.size(); k++ )
+    onElementsRemoved();
+}
+
+////////////////////////////////////////////////////////////
+void Geom::removeVertices(const std::vector<size_t>& indices)
+{
+    std::vector<bool> vertices(m_vertices.size(), false);
+    std::vector<bool> liaisons(m_liaisons.size(), false);
+    std::vector<bool> faces(m_faces.size(), false);
+
+    for( size_t indice : indices )
     {
-        if( &(m_faces[k]->v1) == &vertex || &(m_faces[k]->v2) == &vertex || &(m_faces[k]->v3) == &vertex )
-        {
-            delete m_faces[k];
-            m_faces.erase(m_faces.begin() + k);
+        if( indice < vertices.size() )
+            vertices[indice] = true;
+    }
 
-            for( auto& observer : m_observers )
-                observer->onFaceRemoved(k);
-        }
+    removeElements(vertices, liaisons, faces);
+}
 
-        else k++;
+////////////////////////////////////////////////////////////
+void Geom::removeVertices(size_t begin, size_t end)
+{
+    end = std::min(end, m_vertices.size());
+
+    std::vector<bool> vertices(m_vertices.size(), false);
+    std::vector<bool> liaisons(m_liaisons.size(), false);
+    std::vector<bool> faces(m_faces.size(), false);
+
+    for( size_t k(begin); k < end; k++ )
+        vertices[k] = true;
+
+    removeElements(vertices, liaisons, faces);
+}
+
+////////////////////////////////////////////////////////////
+void Geom::removeLiaisons(const std::vector<size_t>& indices)
+{
+    std::vector<bool> vertices(m_vertices.size(), false);
+    std::vector<bool> liaisons(m_liaisons.size(), false);
+    std::vector<bool> faces(m_faces.size(), false);
+
+    for( size_t indice : indices )
+    {
+        if( indice < liaisons.size() )
+            liaisons[indice] = true;
     }
 
-    for( auto& observer : m_observers )
-        observer->onVertexRemoved(vertex.getIndice());
+    removeElements(vertices, liaisons, faces);
 }
 
 ////////////////////////////////////////////////////////////
-void Geom::removeLiaison(const Liaison& liaison)
+void Geom::removeFaces(const std::vector<size_t>& indices)
+{
+    std::vector<bool> vertices(m_vertices.size(), false);
+    std::vector<bool> liaisons(m_liaisons.size(), false);
+    std::vector<bool> faces(m_faces.size(), false);
+
+    for( size_t indice : indices )
+    {
+        if( indice < faces.size() )
+            faces[indice] = true;
+    }
+
+    removeElements(vertices, liaisons, faces);
+}
+
+////////////////////////////////////////////////////////////
+void Geom::removeElements(const std::vector<bool>& vertices, std::vector<bool>& liaisons, std::vector<bool>& faces)
 {
-    size_t k = 0;
+    size_t removedVertex = std::find(vertices.begin(), vertices.end(), true) - vertices.begin();
+
+    // The kept elements pointing past the first removed vertex are renumbered, from their indice once packed
+    size_t renumberedLiaison(m_liaisons.size());
+    size_t renumberedFace(m_faces.size());
+    size_t kept(0);
+
+    for( size_t k(0); k < m_liaisons.size(); k++ )
+    {
+        const Liaison& liaison = *m_liaisons[k];
+
+        if( vertices[liaison.v1.getIndice()] || vertices[liaison.v2.getIndice()] )
+            liaisons[k] = true;
 
-    for( auto it = m_liaisons.begin(); it != m_liaisons.end(); ++it )
+        else if( !liaisons[k] )
+        {
+            if( renumberedLiaison == m_liaisons.size() && std::max(liaison.v1.getIndice(), liaison.v2.getIndice()) > removedVertex )
+                renumberedLiaison = kept;
+
+            kept++;
+        }
+    }
+
+    kept = 0;
+
+    for( size_t k(0); k < m_faces.size(); k++ )
     {
-        if( *it == &liaison )
+        const Face& face = *m_faces[k];
+
+        if( vertices[face.v1.getIndice()] || vertices[face.v2.getIndice()] || vertices[face.v3.getIndice()] )
+            faces[k] = true;
+
+        else if( !faces[k] )
         {
-            delete *it;
-            m_liaisons.erase(it);
+            if( renumberedFace == m_faces.size() && std::max({face.v1.getIndice(), face.v2.getIndice(), face.v3.getIndice()}) > removedVertex )
+                renumberedFace = kept;
+
+            kept++;
+        }
+    }
 
-            for( auto& observer : m_observers )
-                observer->onLiaisonRemoved(k);
+    size_t liaisonsCount = m_liaisons.size();
+    size_t facesCount = m_faces.size();
+    size_t verticesCount = m_vertices.size();
 
-            break;
+    // The elements are packed in place, so the indices of the ones kept stay in the same order
+    size_t firstLiaison = compact(m_liaisons, m_liaisonPool, liaisons);
+    size_t firstFace = compact(m_faces, m_facePool, faces);
+    size_t firstVertex = compact(m_vertices, m_vertexPool, vertices);
+
+    if( firstVertex < verticesCount )
+    {
+        size_t count(firstVertex);
+
+        for( size_t k(firstVertex); k < verticesCount; k++ )
+        {
+            if( !vertices[k] )
+            {
+                m_coordsX[count] = m_coordsX[k];
+                m_coordsY[count] = m_coordsY[k];
+                count++;
+            }
         }
 
-        k++;
+        m_coordsX.resize(count);
+        m_coordsY.resize(count);
+
+        m_localBoundsUpdated = false;
+        m_globalBoundsUpdated = false;
+    }
+
+    if( firstLiaison < liaisonsCount )
+        m_liaisonTreeUpdated = false;
+
+    if( firstFace < facesCount )
+        m_faceTreeUpdated = false;
+
+    if( m_editDepth > 0 )
+    {
+        extend(m_changes.liaisons, std::min(firstLiaison, renumberedLiaison), m_liaisons.size());
+        extend(m_changes.faces, std::min(firstFace, renumberedFace), m_faces.size());
+
+        if( firstVertex < verticesCount )
+            extend(m_changes.vertices, firstVertex, m_vertices.size());
+    }
+
+    else
+    {
+        // Reported from the last to the first, each indice is valid as if the elements were removed one by one
+        for( auto& observer : m_observers )
+        {
+            for( size_t k(liaisonsCount); k > firstLiaison; k-- )
+            {
+                if( liaisons[k - 1] )
+                    observer->onLiaisonRemoved(k - 1);
+            }
+
+            for( size_t k(facesCount); k > firstFace; k-- )
+            {
+                if( faces[k - 1] )
+                    observer->onFaceRemoved(k - 1);
+            }
+
+            for( size_t k(verticesCount); k > firstVertex; k-- )
+            {
+                if( vertices[k - 1] )
+                    observer->onVertexRemoved(k - 1);
+            }
+        }
     }
+
+    if( firstLiaison < liaisonsCount || firstFace < facesCount || firstVertex < verticesCount )
+        onElementsRemoved();
 }
 
 ////////////////////////////////////////////////////////////
-void Geom::removeFace(const Face& face)
+template <typename T>
+size_t Geom::compact(std::vector<T*>& elements, Pool<T>& pool, const std::vector<bool>& removed)
 {
-    size_t k = 0;
+    size_t first(elements.size());
+    size_t count(0);
 
-    for( auto it = m_faces.begin(); it != m_faces.end(); ++it )
+    for( size_t k(0); k < elements.size(); k++ )
     {
-        if( *it == &face )
+        if( removed[k] )
         {
-            delete *it;
-            m_faces.erase(it);
-
-            for( auto& observer : m_observers )
-                observer->onLiaisonRemoved(k);
+            elements[k]->~T();
+            pool.release(elements[k]);
+            first = std::min(first, k);
+        }
 
-            break;
+        else
+        {
+            elements[count] = elements[k];
+            elements[count]->m_indice = count;
+            count++;
         }
+    }
+
+    elements.resize(count);
+
+    return first;
+}
+
+////////////////////////////////////////////////////////////
+bool Geom::triangulate(bool inside)
+{
+    std::vector<Point> points(m_vertices.size());
 
-        k++;
+    for( size_t k(0); k < points.size(); k++ )
+        points[k] = Point(m_coordsX[k], m_coordsY[k]);
+
+    Delaunay delaunay;
+    delaunay.triangulate(points.data(), points.size());
+
+    // A liaison crossing another would leave its loop open, so the faces are kept
+    for( auto& liaison : m_liaisons )
+    {
+        if( !delaunay.constrain(liaison->v1.getIndice(), liaison->v2.getIndice()) )
+            return false;
     }
+
+    std::vector<size_t> triangles;
+    delaunay.getTriangles(triangles, inside && !m_liaisons.empty());
+
+    std::vector<size_t> faces(m_faces.size());
+
+    for( size_t k(0); k < faces.size(); k++ )
+        faces[k] = k;
+
+    Edit edit(*this);
+    removeFaces(faces);
+
+    m_faces.reserve(triangles.size() / 3);
+
+    for( size_t k(0); k < triangles.size(); k+=3 )
+        addFace(*m_vertices[triangles[k]], *m_vertices[triangles[k + 1]], *m_vertices[triangles[k + 2]]);
+
+    return true;
 }
 
 ////////////////////////////////////////////////////////////
@@ -270,6 +642,17 @@ size_t Geom::getVerticesCount() const
     return m_vertices.size();
 }
 
+////////////////////////////////////////////////////////////
+void Geom::getGlobalCoords(std::vector<Coords>& coords) const
+{
+    coords.resize(m_coordsX.size());
+
+    for( size_t k(0); k < coords.size(); k++ )
+        coords[k] = Coords(m_coordsX[k], m_coordsY[k]);
+
+    convertToGlobal(coords);
+}
+
 ////////////////////////////////////////////////////////////
 size_t Geom::getLiaisonsCount() const
 {
@@ -285,19 +668,29 @@ size_t Geom::getFacesCount() const
 bool Geom::intersects(const Geom& geom) const
 {
     if( getGlobalBounds().intersects(geom.getGlobalBounds()) )
-        
-	    for( auto& liaison1 : m_liaisons )
-	    {
-	        Segment segment1 = liaison1->getSegment();
-	        
-            for( auto& liaison2 : geom.m_liaisons )
+    {
+        const Geom& indexed = getLiaisonsCount() >= geom.getLiaisonsCount() ? *this : geom;
+        const Geom& scanned = &indexed == this ? geom : *this;
+        const BoxTree& tree = indexed.getLiaisonTree();
+
+        std::vector<size_t> candidates;
+
+        for( auto& liaison : scanned.m_liaisons )
+        {
+            Segment segment1 = liaison->getSegment();
+
+            candidates.clear();
+            tree.query(indexed.getLocalBox(segment1, .1f), candidates);
+
+            for( auto& k : candidates )
             {
-                Segment segment2 = liaison2->getSegment();
-                
+                Segment segment2 = indexed.m_liaisons[k]->getSegment();
+
                 if( segment1.intersects(segment2) )
                     return true;
             }
         }
+    }
    
     return false;
 }
@@ -306,36 +699,138 @@ bool Geom::intersects(const Geom& geom) const
 bool Geom::intersects(const Geom& geom, std::vector<Intersection>& intersections)
 {
     if( getGlobalBounds().intersects(geom.getGlobalBounds()) )
+    {
+        bool swapped = getLiaisonsCount() < geom.getLiaisonsCount();
+        const Geom& indexed = swapped ? geom : *this;
+        const Geom& scanned = swapped ? *this : geom;
+        const BoxTree& tree = indexed.getLiaisonTree();
 
-	    for( auto& liaison1 : m_liaisons )
+        std::vector<size_t> candidates;
+        size_t first = intersections.size();
+
+        for( auto& liaison : scanned.m_liaisons )
         {
-	        Segment segment1 = liaison1->getSegment();
-	        
-            for( auto& liaison2 : geom.m_liaisons )
+            Segment segment = liaison->getSegment();
+
+            candidates.clear();
+            tree.query(indexed.getLocalBox(segment, .1f), candidates);
+
+            for( auto& k : candidates )
             {
-                Segment segment2 = liaison2->getSegment();
-                
+                Liaison* liaison1 = swapped ? liaison : indexed.m_liaisons[k];
+                Liaison* liaison2 = swapped ? indexed.m_liaisons[k] : liaison;
+
+                Segment segment1 = liaison1->getSegment(), segment2 = liaison2->getSegment();
                 Point result;
-                
+
                 if( segment1.intersects(segment2, result) )
-                    intersections.push_back(Intersection{convertToGlobal(result), liaison1, liaison2});
+                    intersections.push_back(Intersection{result, liaison1, liaison2});
             }
         }
+
+        std::sort(intersections.begin() + first, intersections.end(), [](const Intersection& a, const Intersection& b)
+        {
+            return a.l1->getIndice() != b.l1->getIndice() ? a.l1->getIndice() < b.l1->getIndice() : a.l2->getIndice() < b.l2->getIndice();
+        });
+    }
 	                         
 	return !intersections.empty();
 }
 
+////////////////////////////////////////////////////////////
+bool Geom::intersects(const std::vector<const Geom*>& geoms, std::vector<Intersection>& intersections)
+{
+    std::vector<Segment> segments;
+    std::vector<const Liaison*> liaisons;
+
+    for( auto& geom : geoms )
+        for( auto& liaison : geom->m_liaisons )
+        {
+            segments.push_back(liaison->getSegment());
+            liaisons.push_back(liaison);
+        }
+
+    std::vector<SweepLine::Crossing> crossings;
+    SweepLine::compute(segments, crossings);
+
+    for( auto& crossing : crossings )
+    {
+        const Liaison* liaison1 = liaisons[crossing.segment1];
+        const Liaison* liaison2 = liaisons[crossing.segment2];
+
+        if( &liaison1->getGeom() != &liaison2->getGeom() )
+            intersections.push_back(Intersection{crossing.result, liaison1, liaison2});
+    }
+
+    return !intersections.empty();
+}
+
+////////////////////////////////////////////////////////////
+bool Geom::selfIntersects() const
+{
+    std::vector<Intersection> intersections;
+    return selfIntersects(intersections);
+}
+
+////////////////////////////////////////////////////////////
+bool Geom::selfIntersects(std::vector<Intersection>& intersections) const
+{
+    std::vector<Segment> segments;
+    segments.reserve(m_liaisons.size());
+
+    for( auto& liaison : m_liaisons )
+        segments.push_back(liaison->getSegment());
+
+    std::vector<SweepLine::Crossing> crossings;
+    SweepLine::compute(segments, crossings);
+
+    for( auto& crossing : crossings )
+    {
+        const Liaison* liaison1 = m_liaisons[crossing.segment1];
+        const Liaison* liaison2 = m_liaisons[crossing.segment2];
+
+        const Vertex* common = &liaison1->v1 == &liaison2->v1 || &liaison1->v1 == &liaison2->v2 ? &liaison1->v1 :
+                               &liaison1->v2 == &liaison2->v1 || &liaison1->v2 == &liaison2->v2 ? &liaison1->v2 : nullptr;
+
+        // Adjacent liaisons only meet at their common vertex, unless they go on along the same line
+        if( common )
+        {
+            const Segment& s1 = segments[crossing.segment1];
+            const Segment& s2 = segments[crossing.segment2];
+
+            Vector2d d1 = common == &liaison1->v1 ? s1.p2 - s1.p1 : s1.p1 - s1.p2,
+                     d2 = common == &liaison2->v1 ? s2.p2 - s2.p1 : s2.p1 - s2.p2;
+
+            bool aligned = Math::abs(d1.x * d2.y - d1.y * d2.x) <= d1.length() * d2.length() * 1e-9;
+
+            if( !aligned || d1.x * d2.x + d1.y * d2.y <= 0 )
+                continue;
+        }
+
+        intersections.push_back(Intersection{crossing.result, liaison1, liaison2});
+    }
+
+    return !intersections.empty();
+}
+
 ////////////////////////////////////////////////////////////
 bool Geom::contains(Point point)
 {
     point = convertToLocal(point);
 
     if( getLocalBounds().contains(point) )
+    {
+        std::vector<size_t> candidates;
+        getFaceTree().query(point, candidates);
 
-        for( auto& face : m_faces )
+        for( auto& k : candidates )
+        {
+            const Face& face = *m_faces[k];
 
-            if( Triangle::contains(face->v1.getCoords(), face->v2.getCoords(), face->v3.getCoords(), point) )
+            if( Triangle::contains(face.v1.getCoords(), face.v2.getCoords(), face.v3.getCoords(), point) )
                 return true;
+        }
+    }
 	
 	return false;
 }
@@ -346,39 +841,177 @@ bool Geom::contains(Point point, std::vector<Face*>& faces)
     point = convertToLocal(point);
 
     if( getLocalBounds().contains(point) )
+    {
+        std::vector<size_t> candidates;
+        getFaceTree().query(point, candidates);
+        std::sort(candidates.begin(), candidates.end());
+
+        for( auto& k : candidates )
+        {
+            Face* face = m_faces[k];
 
-        for( auto& face : m_faces )
-        
             if( Triangle::contains(face->v1.getCoords(), face->v2.getCoords(), face->v3.getCoords(), point) )
                 faces.push_back(face);
+        }
+    }
 	
 	return !faces.empty();
 }
 
 ////////////////////////////////////////////////////////////
-void Geom::computeLocalBounds() const
+size_t Geom::contains(const std::vector<Point>& points, std::vector<bool>& results)
 {
-    Coords min, max;
-    bool init = true;
-        
-    for( auto& vertex : m_vertices )
+    std::vector<Face*> faces;
+    size_t count = contains(points, faces);
+
+    results.resize(points.size());
+
+    for( size_t k(0); k < points.size(); k++ )
+        results[k] = faces[k] != nullptr;
+
+    return count;
+}
+
+////////////////////////////////////////////////////////////
+size_t Geom::contains(const std::vector<Point>& points, std::vector<Face*>& faces)
+{
+    const size_t blockSize = 64;
+
+    const Transform& inverse = getInvTransform();
+    const BoxTree& tree = getFaceTree();
+    Rect bounds = getLocalBounds();
+
+    double a = inverse[0], b = inverse[1], c = inverse[2],
+           d = inverse[3], e = inverse[4], f = inverse[5];
+
+    faces.assign(points.size(), nullptr);
+
+    // Convert the points in one pass and, when the faces are too many to be
+    // all tested per block, sort the ones inside the bounds along a Morton
+    // curve so that each block covers a small area
+
+    std::vector<double> localX(points.size()), localY(points.size());
+    std::vector<Uint64> order;
+
+    auto spread = [](Uint64 value)
+    {
+        value = (value | (value << 8)) & 0x00FF00FF;
+        value = (value | (value << 4)) & 0x0F0F0F0F;
+        value = (value | (value << 2)) & 0x33333333;
+        value = (value | (value << 1)) & 0x55555555;
+
+        return value;
+    };
+
+    for( size_t k(0); k < points.size(); k++ )
     {
-         Coords coords = vertex->getCoords();
-            
-        if( init )
+        localX[k] = a * points[k].x + b * points[k].y + c;
+        localY[k] = d * points[k].x + e * points[k].y + f;
+
+        if( bounds.contains(Point(localX[k], localY[k])) )
         {
-            min = coords;
-            max = coords;
+            Uint64 cellX = Uint64((localX[k] - bounds.pos.x) / bounds.size.x * 65535),
+                   cellY = Uint64((localY[k] - bounds.pos.y) / bounds.size.y * 65535);
 
-            init = false;
+            order.push_back((spread(cellX) | (spread(cellY) << 1)) << 32 | k);
         }
-            
-        else
+    }
+
+    if( m_faces.size() > blockSize )
+        std::sort(order.begin(), order.end());
+
+    double pointsX[blockSize], pointsY[blockSize];
+    Uint8 results[blockSize];
+    size_t indices[blockSize];
+
+    std::vector<size_t> candidates;
+    size_t count = 0;
+
+    for( size_t first(0); first < order.size(); first+=blockSize )
+    {
+        size_t size = std::min(blockSize, order.size() - first);
+        BoxTree::Box box;
+
+        for( size_t k(0); k < size; k++ )
+        {
+            indices[k] = size_t(order[first + k] & 0xFFFFFFFF);
+            pointsX[k] = localX[indices[k]];
+            pointsY[k] = localY[indices[k]];
+
+            BoxTree::Box point{Point(pointsX[k], pointsY[k]), Point(pointsX[k], pointsY[k])};
+            box = k == 0 ? point : BoxTree::merge(box, point);
+        }
+
+        candidates.clear();
+        tree.query(box, candidates);
+
+        if( candidates.size() <= size )
         {
-            min = Coords(std::min(coords.x, min.x), std::min(coords.y, min.y));
-            max = Coords(std::max(coords.x, max.x), std::max(coords.y, max.y));
+            std::sort(candidates.begin(), candidates.end());
+
+            for( auto& i : candidates )
+            {
+                Face* face = m_faces[i];
+
+                std::fill(results, results + size, 0);
+                Triangle::contains(face->v1.getCoords(), face->v2.getCoords(), face->v3.getCoords(), pointsX, pointsY, size, results);
+
+                for( size_t k(0); k < size; k++ )
+                    if( results[k] && !faces[indices[k]] )
+                        faces[indices[k]] = face;
+            }
+        }
+
+        else for( size_t k(0); k < size; k++ )
+        {
+            Point point(pointsX[k], pointsY[k]);
+
+            candidates.clear();
+            tree.query(point, candidates);
+            std::sort(candidates.begin(), candidates.end());
+
+            for( auto& i : candidates )
+            {
+                Face* face = m_faces[i];
+
+                if( Triangle::contains(face->v1.getCoords(), face->v2.getCoords(), face->v3.getCoords(), point) )
+                {
+                    faces[indices[k]] = face;
+                    break;
+                }
+            }
+        }
+
+        for( size_t k(0); k < size; k++ )
+            if( faces[indices[k]] )
+                count++;
+    }
+
+    return count;
+}
+
+////////////////////////////////////////////////////////////
+void Geom::computeLocalBounds() const
+{
+    Coords min, max;
+    size_t size = m_coordsX.size();
+
+    if( size > 0 )
+    {
+        min = max = Coords(m_coordsX[0], m_coordsY[0]);
+
+        for( size_t k(1); k < size; k++ )
+        {
+            min.x = std::min(m_coordsX[k], min.x);
+            min.y = std::min(m_coordsY[k], min.y);
+            max.x = std::max(m_coordsX[k], max.x);
+            max.y = std::max(m_coordsY[k], max.y);
         }
     }
+
+    m_localBox.min = min;
+    m_localBox.max = max;
+    m_hullUpdated = false;
         
     m_localBounds.pos  = min;
     m_localBounds.size = max - min;
@@ -393,25 +1026,78 @@ void Geom::computeLocalBounds() const
 ////////////////////////////////////////////////////////////
 void Geom::computeGlobalBounds() const
 {
+    const Transform& transform = getTransform();
+
+    double a = transform[0], b = transform[1], c = transform[2],
+           d = transform[3], e = transform[4], f = transform[5];
+
     Coords min, max;
-    bool init = true;
-        
-    for( auto& vertex : m_vertices )
+    size_t size = m_coordsX.size();
+
+    // Without rotation nor shear each axis maps on itself, so the local extremes stay the extremes
+    if( size > 0 && b == 0 && d == 0 )
+    {
+        getLocalBounds();
+
+        double x1 = a * m_localBox.min.x + c, x2 = a * m_localBox.max.x + c,
+               y1 = e * m_localBox.min.y + f, y2 = e * m_localBox.max.y + f;
+
+        min = Coords(std::min(x1, x2), std::min(y1, y2));
+        max = Coords(std::max(x1, x2), std::max(y1, y2));
+    }
+
+    else if( size > 0 && m_boundsMode == LocalBounds )
     {
-         Coords coords = convertToGlobal(vertex->getCoords());
-            
-        if( init )
+        getLocalBounds();
+
+        const Point corners[4] = {m_localBox.min, Point(m_localBox.max.x, m_localBox.min.y), m_localBox.max, Point(m_localBox.min.x, m_localBox.max.y)};
+
+        min = max = Coords(a * corners[0].x + b * corners[0].y + c, d * corners[0].x + e * corners[0].y + f);
+
+        for( size_t k(1); k < 4; k++ )
         {
-            min = coords;
-            max = coords;
+            double x = a * corners[k].x + b * corners[k].y + c,
+                   y = d * corners[k].x + e * corners[k].y + f;
 
-            init = false;
+            min.x = std::min(x, min.x);
+            min.y = std::min(y, min.y);
+            max.x = std::max(x, max.x);
+            max.y = std::max(y, max.y);
         }
-            
-        else
+    }
+
+    // A linear map reaches its extremes on the convex hull
+    else if( size > 0 && m_boundsMode == Hull )
+    {
+        const std::vector<Point>& hull = getHull();
+
+        min = max = Coords(a * hull[0].x + b * hull[0].y + c, d * hull[0].x + e * hull[0].y + f);
+
+        for( size_t k(1); k < hull.size(); k++ )
         {
-            min = Coords(std::min(coords.x, min.x), std::min(coords.y, min.y));
-            max = Coords(std::max(coords.x, max.x), std::max(coords.y, max.y));
+            double x = a * hull[k].x + b * hull[k].y + c,
+                   y = d * hull[k].x + e * hull[k].y + f;
+
+            min.x = std::min(x, min.x);
+            min.y = std::min(y, min.y);
+            max.x = std::max(x, max.x);
+            max.y = std::max(y, max.y);
+        }
+    }
+
+    else if( size > 0 )
+    {
+        min = max = Coords(a * m_coordsX[0] + b * m_coordsY[0] + c, d * m_coordsX[0] + e * m_coordsY[0] + f);
+
+        for( size_t k(1); k < size; k++ )
+        {
+            double x = a * m_coordsX[k] + b * m_coordsY[k] + c,
+                   y = d * m_coordsX[k] + e * m_coordsY[k] + f;
+
+            min.x = std::min(x, min.x);
+            min.y = std::min(y, min.y);
+            max.x = std::max(x, max.x);
+            max.y = std::max(y, max.y);
         }
     }
         
@@ -449,6 +1135,34 @@ Rect Geom::getGlobalBounds() const
     return m_globalBounds;
 }
 
+////////////////////////////////////////////////////////////
+void Geom::setBoundsMode(BoundsMode mode)
+{
+    m_boundsMode = mode;
+    m_globalBoundsUpdated = false;
+}
+
+////////////////////////////////////////////////////////////
+Geom::BoundsMode Geom::getBoundsMode() const
+{
+    return m_boundsMode;
+}
+
+////////////////////////////////////////////////////////////
+const std::vector<Point>& Geom::getHull() const
+{
+    // The hull is outdated as soon as the local bounds are computed again
+    getLocalBounds();
+
+    if( !m_hullUpdated )
+    {
+        computeHull();
+        m_hullUpdated = true;
+    }
+
+    return m_hull;
+}
+
 ////////////////////////////////////////////////////////////
 void Geom::onTransformUpdated() const
 {
@@ -459,13 +1173,203 @@ void Geom::onTransformUpdated() const
 }
 
 ////////////////////////////////////////////////////////////
-void Geom::onVertexMoved() const
+void Geom::onVertexMoved(size_t indice) const
 {
     m_localBoundsUpdated = false;
     m_globalBoundsUpdated = false;
+    m_liaisonTreeFitted = false;
+    m_faceTreeFitted = false;
 
-    for( auto& observer : m_observers )
-        observer->onVertexMoved();
+    if( m_editDepth > 0 )
+        extend(m_changes.vertices, indice, indice + 1);
+
+    else
+    {
+        for( auto& observer : m_observers )
+            observer->onVertexMoved();
+    }
+}
+
+////////////////////////////////////////////////////////////
+void Geom::onElementsRemoved() {}
+
+////////////////////////////////////////////////////////////
+void Geom::extend(Range& range, size_t begin, size_t end)
+{
+    if( begin >= end )
+        return;
+
+    if( range.begin >= range.end )
+        range = Range{begin, end};
+
+    else
+    {
+        range.begin = std::min(range.begin, begin);
+        range.end = std::max(range.end, end);
+    }
+}
+
+////////////////////////////////////////////////////////////
+const BoxTree& Geom::getLiaisonTree() const
+{
+    if( !m_liaisonTreeUpdated || !m_liaisonTreeFitted )
+    {
+        std::vector<BoxTree::Box> boxes;
+        boxes.reserve(m_liaisons.size());
+
+        for( auto& liaison : m_liaisons )
+        {
+            size_t i = liaison->v1.getIndice(), j = liaison->v2.getIndice();
+            boxes.push_back(BoxTree::bound(Point(m_coordsX[i], m_coordsY[i]), Point(m_coordsX[j], m_coordsY[j])));
+        }
+
+        if( m_liaisonTreeUpdated )
+            m_liaisonTree.refit(boxes);
+
+        else m_liaisonTree.build(boxes);
+
+        m_liaisonTreeUpdated = true;
+        m_liaisonTreeFitted = true;
+    }
+
+    return m_liaisonTree;
+}
+
+////////////////////////////////////////////////////////////
+const BoxTree& Geom::getFaceTree() const
+{
+    if( !m_faceTreeUpdated || !m_faceTreeFitted )
+    {
+        std::vector<BoxTree::Box> boxes;
+        boxes.reserve(m_faces.size());
+
+        for( auto& face : m_faces )
+        {
+            size_t i = face->v1.getIndice(), j = face->v2.getIndice(), k = face->v3.getIndice();
+            boxes.push_back(BoxTree::bound(Point(m_coordsX[i], m_coordsY[i]), Point(m_coordsX[j], m_coordsY[j]), Point(m_coordsX[k], m_coordsY[k])));
+        }
+
+        if( m_faceTreeUpdated )
+            m_faceTree.refit(boxes);
+
+        else m_faceTree.build(boxes);
+
+        m_faceTreeUpdated = true;
+        m_faceTreeFitted = true;
+    }
+
+    return m_faceTree;
+}
+
+////////////////////////////////////////////////////////////
+void Geom::computeHull() const
+{
+    size_t size = m_coordsX.size();
+    std::vector<size_t> order(size);
+
+    for( size_t k(0); k < size; k++ )
+        order[k] = k;
+
+    std::sort(order.begin(), order.end(), [this](size_t i, size_t j) { return m_coordsX[i] < m_coordsX[j] || ( m_coordsX[i] == m_coordsX[j] && m_coordsY[i] < m_coordsY[j] ); });
+
+    m_hull.clear();
+
+    if( size < 3 )
+    {
+        for( auto& k : order )
+            m_hull.push_back(Point(m_coordsX[k], m_coordsY[k]));
+
+        return;
+    }
+
+    // Monotone chain, the lower half from left to right then the upper half back
+    m_hull.resize(2 * size);
+    size_t count = 0;
+
+    auto turnsLeft = [](const Point& p1, const Point& p2, double x, double y) { return (p2.x - p1.x) * (y - p1.y) - (p2.y - p1.y) * (x - p1.x) > 0; };
+
+    for( size_t k(0); k < size; k++ )
+    {
+        double x = m_coordsX[order[k]], y = m_coordsY[order[k]];
+
+        while( count >= 2 && !turnsLeft(m_hull[count - 2], m_hull[count - 1], x, y) )
+            count--;
+
+        m_hull[count++] = Point(x, y);
+    }
+
+    for( size_t k(size - 1), lower(count + 1); k-- > 0; )
+    {
+        double x = m_coordsX[order[k]], y = m_coordsY[order[k]];
+
+        while( count >= lower && !turnsLeft(m_hull[count - 2], m_hull[count - 1], x, y) )
+            count--;
+
+        m_hull[count++] = Point(x, y);
+    }
+
+    m_hull.resize(count - 1);
+}
+
+////////////////////////////////////////////////////////////
+void Geom::swapElements(Geom& geom)
+{
+    m_coordsX.swap(geom.m_coordsX);
+    m_coordsY.swap(geom.m_coordsY);
+    m_vertices.swap(geom.m_vertices);
+    m_liaisons.swap(geom.m_liaisons);
+    m_faces.swap(geom.m_faces);
+    m_vertexPool.swap(geom.m_vertexPool);
+    m_liaisonPool.swap(geom.m_liaisonPool);
+    m_facePool.swap(geom.m_facePool);
+
+    // The trees & the hull are in local space, they follow the elements
+    std::swap(m_liaisonTree, geom.m_liaisonTree);
+    std::swap(m_faceTree, geom.m_faceTree);
+    std::swap(m_liaisonTreeUpdated, geom.m_liaisonTreeUpdated);
+    std::swap(m_liaisonTreeFitted, geom.m_liaisonTreeFitted);
+    std::swap(m_faceTreeUpdated, geom.m_faceTreeUpdated);
+    std::swap(m_faceTreeFitted, geom.m_faceTreeFitted);
+    m_hull.swap(geom.m_hull);
+    std::swap(m_hullUpdated, geom.m_hullUpdated);
+    std::swap(m_localBounds, geom.m_localBounds);
+    std::swap(m_localBox, geom.m_localBox);
+    std::swap(m_localBoundsUpdated, geom.m_localBoundsUpdated);
+    std::swap(m_boundsMode, geom.m_boundsMode);
+
+    m_globalBoundsUpdated = false;
+    geom.m_globalBoundsUpdated = false;
+
+    // The elements point back to their geom
+    for( auto& vertex : m_vertices )
+        vertex->m_geom = this;
+
+    for( auto& liaison : m_liaisons )
+        liaison->m_geom = this;
+
+    for( auto& face : m_faces )
+        face->m_geom = this;
+
+    for( auto& vertex : geom.m_vertices )
+        vertex->m_geom = &geom;
+
+    for( auto& liaison : geom.m_liaisons )
+        liaison->m_geom = &geom;
+
+    for( auto& face : geom.m_faces )
+        face->m_geom = &geom;
+}
+
+////////////////////////////////////////////////////////////
+BoxTree::Box Geom::getLocalBox(const Segment& segment, double margin) const
+{
+    BoxTree::Box box = BoxTree::bound(segment.p1, segment.p2);
+
+    box.min -= margin;
+    box.max += margin;
+
+    return BoxTree::merge(BoxTree::bound(convertToLocal(box.min), convertToLocal(box.max)),
+                          BoxTree::bound(convertToLocal(box.min.x, box.max.y), convertToLocal(box.max.x, box.min.y)));
 }
 
 ////////////////////////////////////////////////////////////
@@ -620,89 +1524,91 @@ Geom Geom::polygon(double width, unsigned int complexity)
 
 ////////////////////////////////////////////////////////////
 Geom Geom::polygon(const std::initializer_list<Point>& points)
+{
+    return polygon(points.begin(), points.size());
+}
+
+////////////////////////////////////////////////////////////
+Geom Geom::polygon(const std::vector<Point>& points)
+{
+    return polygon(points.data(), points.size());
+}
+
+////////////////////////////////////////////////////////////
+Geom Geom::polygon(const Point* points, size_t count)
 {
     Geom geom;
 
-    if( points.size() > 3 )
+    if( count > 3 )
     {
-        for( auto& pts : points )
-            geom.addVertex(pts);
+        geom.m_vertices.reserve(count);
+        geom.m_coordsX.reserve(count);
+        geom.m_coordsY.reserve(count);
+        geom.m_liaisons.reserve(count);
+        geom.m_faces.reserve(count - 2);
 
-        size_t size = geom.getVerticesCount();
+        for( size_t k(0); k < count; k++ )
+            geom.addVertex(points[k]);
 
-        std::vector<size_t> index;
+        for( size_t k(0); k < count; k++ )
+            geom.addLiaison(geom.getVertex(k), geom.getVertex((k + 1) % count));
 
-        for( size_t k(0); k < size; k++ )
-        {
-            index.push_back(k);
+        std::vector<size_t> triangles;
+        Triangulation::earClipping(points, count, triangles);
 
-            if( k < size - 1 )
-                geom.addLiaison(geom.getVertex(k), geom.getVertex(k + 1));
+        for( size_t k(0); k < triangles.size(); k+=3 )
+            geom.addFace(geom.getVertex(triangles[k]), geom.getVertex(triangles[k + 1]), geom.getVertex(triangles[k + 2]));
+    }
 
-            else geom.addLiaison(geom.getVertex(k), geom.getVertex(0));
-        }
+    else if( count == 3 )
+        geom = triangle(points[0], points[1], points[2]);
 
-        double sum = 0;
+    else if( count == 2 )
+        geom = segment(points[0], points[1]);
 
-        for( size_t k(0); k < size; k++ )
-        {
-            Coords p1 = geom.getVertex(index[k]).getCoords(), p2 = geom.getVertex(index[(k + 1) % size]).getCoords();
-            sum+=(p1.x*p2.y - p2.x*p1.y);
-        }
+    return geom;
+}
 
-        double orientation = sum / Math::abs(sum);
+////////////////////////////////////////////////////////////
+Geom Geom::polygon(const std::vector<std::vector<Point>>& contours)
+{
+    Geom geom;
 
-        while( size > 1 )
+    std::vector<Point> points;
+    std::vector<std::vector<size_t>> rings(contours.size());
 
-            for( size_t i(0); i < size; i++ )
-            {
-                size_t a = i == 0 ? size - 1 : i - 1, b = i, c = (i + 1) % size;
+    for( size_t k(0); k < contours.size(); k++ )
+    {
+        for( auto& point : contours[k] )
+        {
+            rings[k].push_back(points.size());
+            points.push_back(point);
+        }
+    }
 
-                Coords A = geom.getVertex(index[a]).getCoords(),
-                       B = geom.getVertex(index[b]).getCoords(),
-                       C = geom.getVertex(index[c]).getCoords();
+    geom.m_vertices.reserve(points.size());
+    geom.m_coordsX.reserve(points.size());
+    geom.m_coordsY.reserve(points.size());
+    geom.m_liaisons.reserve(points.size());
+    geom.m_faces.reserve(points.size());
 
-                if( Vector2d::angle(Coords(B - A), Coords(C - B)) * orientation >= 0 )
-                {
-                    bool earFound = true;
-
-                    for( size_t k(0); k < size; k++ )
-                    {
-                        Coords P = geom.getVertex(index[k]).getCoords();
-
-                        if( A != P && B != P && C != P )
-                        
-                            if( Triangle::contains(A, B, C, P) )
-                            {
-                                earFound = false;
-                                break;
-                            }
-                    }
-
-                    if( earFound )
-                    {
-                        geom.addFace(geom.getVertex(index[a]), geom.getVertex(index[b]), geom.getVertex(index[c]));
-                        index.erase(index.begin() + i);
-                        size = index.size();
-
-                        break;
-                    }
-                }
-            }
-    }
+    for( auto& point : points )
+        geom.addVertex(point);
 
-    else
+    // Each contour is closed by its liaisons, the vertices being shared by the faces of all of them
+    for( auto& ring : rings )
     {
-        std::vector<Coords> pts = points;
+        for( size_t k(0); ring.size() > 1 && k < ring.size(); k++ )
+            geom.addLiaison(geom.getVertex(ring[k]), geom.getVertex(ring[(k + 1) % ring.size()]));
+    }
 
-        if( pts.size() == 3 )
-            geom = triangle(pts[0], pts[1], pts[2]);
+    std::vector<size_t> triangles;
+    Triangulation::earClipping(points.data(), rings, triangles);
 
-        else if( pts.size() == 2 )
-            geom = segment(pts[0], pts[1]);
+    for( size_t k(0); k < triangles.size(); k+=3 )
+        geom.addFace(geom.getVertex(triangles[k]), geom.getVertex(triangles[k + 1]), geom.getVertex(triangles[k + 2]));
 
-        return geom;
-    }
+    return geom;
 }
 
 }
\ No newline at end of file
@@ -31,13 +31,26 @@ namespace zin
 ////////////////////////////////////////////////////////////
 Segment Liaison::getSegment()
 {
-    return Segment(m_geom.convertToGlobal(v1.getCoords()), m_geom.convertToGlobal(v2.getCoords()));
+    return Segment(m_geom->convertToGlobal(v1.getCoords()), m_geom->convertToGlobal(v2.getCoords()));
 }
 
 ////////////////////////////////////////////////////////////
-Liaison::Liaison(const Vertex& vertex1, const Vertex& vertex2, const Geom& geom) :
+size_t Liaison::getIndice() const
+{
+    return m_indice;
+}
+
+////////////////////////////////////////////////////////////
+const Geom& Liaison::getGeom() const
+{
+    return *m_geom;
+}
+
+////////////////////////////////////////////////////////////
+Liaison::Liaison(const Vertex& vertex1, const Vertex& vertex2, size_t indice, const Geom& geom) :
 v1(vertex1),
 v2(vertex2),
-m_geom(geom) {}
+m_geom(&geom),
+m_indice(indice) {}
 
 }
\ No newline at end of file
@@ -31,21 +31,45 @@ namespace Math
 {
 
 ////////////////////////////////////////////////////////////
-unsigned int ZOOST_API fact(unsigned int n)
+Uint64 ZOOST_API fact(unsigned int n)
 {
-	return n <= 1 ? 1 : n * fact(n - 1);
+	Uint64 result = 1;
+
+	for( unsigned int k(2); k <= n; k++ )
+		result*=k;
+
+	return result;
 }
 
 ////////////////////////////////////////////////////////////
-unsigned int ZOOST_API binCoef(unsigned int n, unsigned int k)
+Uint64 ZOOST_API binCoef(unsigned int n, unsigned int k)
 {
-	return k <= n ? fact(n) / ( fact(k) * fact(n - k) ) : 0;
+	if( k > n )
+		return 0;
+
+	if( k > n - k )
+		k = n - k;
+
+	// C(n, i) = C(n, i - 1) * (n - k + i) / i, the product split so that
+	// it only overflows when the coefficient itself does
+	Uint64 result = 1;
+
+	for( unsigned int i(1); i <= k; i++ )
+	{
+		Uint64 factor = n - k + i;
+		result = (result / i) * factor + (result % i) * factor / i;
+	}
+
+	return result;
 }
 
 ////////////////////////////////////////////////////////////
 double ZOOST_API bernstein(unsigned int k, unsigned int n, double t)
 {
-	return binCoef(n, k) * pow(t, double(k)) * pow(1.f - t, double(n - k));
+	if( k > n )
+		return 0;
+
+	return binomial<double>(n, k) * pow(t, double(k)) * pow(1 - t, double(n - k));
 }
 
 }
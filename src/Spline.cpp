@@ -0,0 +1,230 @@
+////////////////////////////////////////////////////////////
+//
+// Zoost C++ library
+// Copyright (C) 2011-2012 Pierre-Emmanuel BRIAN (zinlibs@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#include <Zoost/Spline.hpp>
+#include <algorithm>
+#include <utility>
+
+namespace zin
+{
+
+////////////////////////////////////////////////////////////
+Spline::Spline(Type type, Uint32 complexity) :
+m_type(type),
+m_complexity(std::max<Uint32>(complexity, 1)) {}
+
+////////////////////////////////////////////////////////////
+Spline::Spline(Type type, const std::initializer_list<Point>& keyPoints, Uint32 complexity) :
+m_type(type),
+m_complexity(std::max<Uint32>(complexity, 1))
+{
+    std::vector<Point> points = keyPoints;
+    addKeyPoints(points.data(), points.size());
+}
+
+////////////////////////////////////////////////////////////
+Spline::Spline(const Spline& spline) :
+Curve(spline),
+m_type(spline.m_type),
+m_complexity(spline.m_complexity),
+m_keyPoints(spline.m_keyPoints) {}
+
+////////////////////////////////////////////////////////////
+Spline::Spline(Spline&& spline) :
+m_type(spline.m_type),
+m_complexity(spline.m_complexity)
+{
+    *this = std::move(spline);
+}
+
+////////////////////////////////////////////////////////////
+Spline& Spline::operator=(const Spline& spline)
+{
+    if( &spline != this )
+    {
+        Curve::operator=(spline);
+        m_type = spline.m_type;
+        m_complexity = spline.m_complexity;
+        m_keyPoints = spline.m_keyPoints;
+    }
+
+    return *this;
+}
+
+////////////////////////////////////////////////////////////
+Spline& Spline::operator=(Spline&& spline)
+{
+    if( &spline != this )
+    {
+        // The geom clears the moved spline, its key points are taken first
+        std::vector<Point> keyPoints;
+        keyPoints.swap(spline.m_keyPoints);
+
+        Curve::operator=(std::move(spline));
+        m_type = spline.m_type;
+        m_complexity = spline.m_complexity;
+        m_keyPoints.swap(keyPoints);
+    }
+
+    return *this;
+}
+
+////////////////////////////////////////////////////////////
+Spline::Type Spline::getType() const
+{
+    return m_type;
+}
+
+////////////////////////////////////////////////////////////
+Uint32 Spline::getComplexity() const
+{
+    return m_complexity;
+}
+
+////////////////////////////////////////////////////////////
+void Spline::addKeyPoint(const Point& point)
+{
+    addKeyPoints(&point, 1);
+}
+
+////////////////////////////////////////////////////////////
+void Spline::addKeyPoints(const Point* points, size_t count)
+{
+    if( count == 0 )
+        return;
+
+    Edit edit(*this);
+    size_t spans = m_keyPoints.size() > 1 ? m_keyPoints.size() - 1 : 0;
+
+    m_keyPoints.insert(m_keyPoints.end(), points, points + count);
+
+    if( getVerticesCount() == 0 )
+        addVertex(m_keyPoints[0]);
+
+    // The last span was ending on a mirrored control point, now a real one
+    if( spans > 0 )
+        updateSpans(spans - 1, spans);
+
+    for( size_t span(spans); span + 1 < m_keyPoints.size(); span++ )
+    {
+        for( Uint32 k(1); k <= m_complexity; k++ )
+            addVertex(getSpanPoint(span, double(k) / double(m_complexity)));
+    }
+}
+
+////////////////////////////////////////////////////////////
+void Spline::setKeyPoint(size_t indice, const Point& point)
+{
+    m_keyPoints[indice] = point;
+
+    if( m_keyPoints.size() == 1 )
+    {
+        getVertex(0).setCoords(point);
+        return;
+    }
+
+    // A span depends on the key points from the one before its start to the one after its end
+    size_t spans = m_keyPoints.size() - 1;
+
+    Edit edit(*this);
+    updateSpans(indice > 2 ? indice - 2 : 0, std::min(indice + 2, spans));
+}
+
+////////////////////////////////////////////////////////////
+const Point& Spline::getKeyPoint(size_t indice) const
+{
+    return m_keyPoints[indice];
+}
+
+////////////////////////////////////////////////////////////
+size_t Spline::getKeyPointsCount() const
+{
+    return m_keyPoints.size();
+}
+
+////////////////////////////////////////////////////////////
+void Spline::clear()
+{
+    Curve::clear();
+
+    m_keyPoints.clear();
+}
+
+////////////////////////////////////////////////////////////
+Point Spline::getControlPoint(long indice) const
+{
+    long count = long(m_keyPoints.size());
+
+    // Mirroring the neighbour makes both types pass by the end key points
+    if( indice < 0 )
+        return Point(2 * m_keyPoints[0].x - m_keyPoints[1].x, 2 * m_keyPoints[0].y - m_keyPoints[1].y);
+
+    else if( indice >= count )
+        return Point(2 * m_keyPoints[count - 1].x - m_keyPoints[count - 2].x, 2 * m_keyPoints[count - 1].y - m_keyPoints[count - 2].y);
+
+    return m_keyPoints[indice];
+}
+
+////////////////////////////////////////////////////////////
+Point Spline::getSpanPoint(size_t span, double factor) const
+{
+    Point p0 = getControlPoint(long(span) - 1),
+          p1 = getControlPoint(long(span)),
+          p2 = getControlPoint(long(span) + 1),
+          p3 = getControlPoint(long(span) + 2);
+
+    double t = factor, t2 = t * t, t3 = t2 * t, w0, w1, w2, w3;
+
+    if( m_type == CatmullRom )
+    {
+        w0 = 0.5 * (-t3 + 2 * t2 - t);
+        w1 = 0.5 * (3 * t3 - 5 * t2 + 2);
+        w2 = 0.5 * (-3 * t3 + 4 * t2 + t);
+        w3 = 0.5 * (t3 - t2);
+    }
+
+    else
+    {
+        double s = 1 - t;
+
+        w0 = s * s * s / 6;
+        w1 = (3 * t3 - 6 * t2 + 4) / 6;
+        w2 = (-3 * t3 + 3 * t2 + 3 * t + 1) / 6;
+        w3 = t3 / 6;
+    }
+
+    return Point(p0.x * w0 + p1.x * w1 + p2.x * w2 + p3.x * w3, p0.y * w0 + p1.y * w1 + p2.y * w2 + p3.y * w3);
+}
+
+////////////////////////////////////////////////////////////
+void Spline::updateSpans(size_t begin, size_t end)
+{
+    for( size_t span(begin); span < end; span++ )
+    {
+        for( Uint32 k(span == begin ? 0 : 1); k <= m_complexity; k++ )
+            getVertex(span * m_complexity + k).setCoords(getSpanPoint(span, double(k) / double(m_complexity)));
+    }
+}
+
+}
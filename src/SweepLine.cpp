@@ -0,0 +1,262 @@
+////////////////////////////////////////////////////////////
+//
+// Zoost C++ library
+// Copyright (C) 2011-2012 Pierre-Emmanuel BRIAN (zinlibs@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#include <Zoost/SweepLine.hpp>
+#include <algorithm>
+#include <limits>
+
+namespace zin
+{
+
+////////////////////////////////////////////////////////////
+SweepLine::SweepLine(const std::vector<Segment>& segments) :
+m_segments(segments),
+m_status(StatusLess{this}),
+m_probe(0),
+m_epsilon(0)
+{
+    double extent = 1;
+
+    for( auto& segment : m_segments )
+    {
+        if( segment.p2.x < segment.p1.x || (segment.p2.x == segment.p1.x && segment.p2.y < segment.p1.y) )
+            std::swap(segment.p1, segment.p2);
+
+        extent = std::max(extent, std::max(Math::abs(segment.p1.x), Math::abs(segment.p1.y)));
+        extent = std::max(extent, std::max(Math::abs(segment.p2.x), Math::abs(segment.p2.y)));
+    }
+
+    m_epsilon = extent * 1e-9;
+
+    // The last segment stands for the probe used to search the status
+
+    m_segments.push_back(Segment(Point(), Point()));
+}
+
+////////////////////////////////////////////////////////////
+void SweepLine::compute(std::vector<Crossing>& crossings)
+{
+    size_t probe = m_segments.size() - 1;
+
+    m_events.clear();
+    m_status.clear();
+
+    for( size_t k(0); k < probe; k++ )
+    {
+        if( m_segments[k].p1 == m_segments[k].p2 )
+            continue;
+
+        m_events[m_segments[k].p1].push_back(k);
+        m_events[m_segments[k].p2];
+    }
+
+    size_t first = crossings.size();
+
+    while( !m_events.empty() )
+    {
+        Point point = m_events.begin()->first;
+        std::vector<size_t> starts;
+
+        starts.swap(m_events.begin()->second);
+        m_events.erase(m_events.begin());
+
+        handle(point, starts, crossings);
+    }
+
+    // Collinear overlaps are met at several events, keep their first point only
+
+    std::set<std::pair<size_t, size_t>> reported;
+
+    auto end = std::remove_if(crossings.begin() + first, crossings.end(), [&](const Crossing& crossing)
+    {
+        return !reported.insert(std::make_pair(crossing.segment1, crossing.segment2)).second;
+    });
+
+    crossings.erase(end, crossings.end());
+}
+
+////////////////////////////////////////////////////////////
+void SweepLine::compute(const std::vector<Segment>& segments, std::vector<Crossing>& crossings)
+{
+    SweepLine sweep(segments);
+    sweep.compute(crossings);
+}
+
+////////////////////////////////////////////////////////////
+bool SweepLine::EventLess::operator()(const Point& point1, const Point& point2) const
+{
+    return point1.x < point2.x || (point1.x == point2.x && point1.y < point2.y);
+}
+
+////////////////////////////////////////////////////////////
+bool SweepLine::StatusLess::operator()(size_t segment1, size_t segment2) const
+{
+    if( segment1 == segment2 )
+        return false;
+
+    double height1 = sweep->getHeight(segment1), height2 = sweep->getHeight(segment2);
+    size_t probe = sweep->m_segments.size() - 1;
+
+    if( segment1 == probe || segment2 == probe || Math::abs(height1 - height2) > sweep->m_epsilon )
+        return height1 < height2;
+
+    // Both segments go through the sweep point, order them as just after it
+
+    double slope1 = sweep->getSlope(segment1), slope2 = sweep->getSlope(segment2);
+
+    if( slope1 != slope2 )
+        return slope1 < slope2;
+
+    return segment1 < segment2;
+}
+
+////////////////////////////////////////////////////////////
+double SweepLine::getHeight(size_t segment) const
+{
+    if( segment == m_segments.size() - 1 )
+        return m_probe;
+
+    const Segment& s = m_segments[segment];
+
+    if( s.p1.x == s.p2.x )
+        return std::min(std::max(m_sweep.y, s.p1.y), s.p2.y);
+
+    if( m_sweep.x <= s.p1.x )
+        return s.p1.y;
+
+    if( m_sweep.x >= s.p2.x )
+        return s.p2.y;
+
+    return s.p1.y + (m_sweep.x - s.p1.x) * (s.p2.y - s.p1.y) / (s.p2.x - s.p1.x);
+}
+
+////////////////////////////////////////////////////////////
+double SweepLine::getSlope(size_t segment) const
+{
+    const Segment& s = m_segments[segment];
+
+    if( s.p1.x == s.p2.x )
+        return std::numeric_limits<double>::infinity();
+
+    return (s.p2.y - s.p1.y) / (s.p2.x - s.p1.x);
+}
+
+////////////////////////////////////////////////////////////
+void SweepLine::handle(const Point& point, const std::vector<size_t>& starts, std::vector<Crossing>& crossings)
+{
+    m_sweep = point;
+    m_probe = point.y - m_epsilon;
+
+    // Gather the segments of the status going through the point
+
+    auto first = m_status.lower_bound(m_segments.size() - 1), last = first;
+
+    std::vector<size_t> ends, passes;
+
+    while( last != m_status.end() && getHeight(*last) <= point.y + m_epsilon )
+    {
+        const Point& end = m_segments[*last].p2;
+
+        if( Math::abs(end.x - point.x) <= m_epsilon && Math::abs(end.y - point.y) <= m_epsilon )
+            ends.push_back(*last);
+
+        else passes.push_back(*last);
+
+        ++last;
+    }
+
+    std::vector<size_t> all(starts);
+    all.insert(all.end(), ends.begin(), ends.end());
+    all.insert(all.end(), passes.begin(), passes.end());
+
+    for( size_t i(0); i < all.size(); i++ )
+        for( size_t j(i + 1); j < all.size(); j++ )
+            crossings.push_back(Crossing{point, std::min(all[i], all[j]), std::max(all[i], all[j])});
+
+    // Replace the segments going through the point by the ones leaving it
+
+    auto below = first == m_status.begin() ? m_status.end() : std::prev(first), above = last;
+
+    m_status.erase(first, last);
+
+    for( auto& segment : starts )
+        m_status.insert(segment);
+
+    for( auto& segment : passes )
+        m_status.insert(segment);
+
+    if( starts.empty() && passes.empty() )
+    {
+        if( below != m_status.end() && above != m_status.end() )
+            schedule(*below, *above, point);
+    }
+
+    else
+    {
+        auto lowest = below == m_status.end() ? m_status.begin() : std::next(below), highest = std::prev(above);
+
+        if( below != m_status.end() )
+            schedule(*below, *lowest, point);
+
+        if( above != m_status.end() )
+            schedule(*highest, *above, point);
+    }
+}
+
+////////////////////////////////////////////////////////////
+void SweepLine::schedule(size_t segment1, size_t segment2, const Point& point)
+{
+    const Segment& s1 = m_segments[segment1];
+    const Segment& s2 = m_segments[segment2];
+
+    Vector2d d1 = s1.p2 - s1.p1, d2 = s2.p2 - s2.p1, d = s2.p1 - s1.p1;
+
+    double denominator = d1.x * d2.y - d1.y * d2.x;
+
+    if( denominator == 0 )
+        return;
+
+    double t = (d.x * d2.y - d.y * d2.x) / denominator,
+           u = (d.x * d1.y - d.y * d1.x) / denominator;
+
+    if( t < 0 || t > 1 || u < 0 || u > 1 )
+        return;
+
+    Point result(s1.p1.x + d1.x * t, s1.p1.y + d1.y * t);
+
+    if( result.x < point.x - m_epsilon || (result.x <= point.x + m_epsilon && result.y <= point.y + m_epsilon) )
+        return;
+
+    // Merge the crossing with an already queued event lying at the same place
+
+    auto it = m_events.lower_bound(Point(result.x - m_epsilon, -std::numeric_limits<double>::infinity()));
+
+    for( ; it != m_events.end() && it->first.x <= result.x + m_epsilon; ++it )
+        if( Math::abs(it->first.y - result.y) <= m_epsilon )
+            return;
+
+    m_events[result];
+}
+
+}
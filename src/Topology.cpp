@@ -0,0 +1,521 @@
+////////////////////////////////////////////////////////////
+//
+// Zoost C++ library
+// Copyright (C) 2011-2012 Pierre-Emmanuel BRIAN (zinlibs@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#include <Zoost/Topology.hpp>
+#include <algorithm>
+
+namespace zin
+{
+
+////////////////////////////////////////////////////////////
+Topology::Listener::Listener(Topology& topology) :
+topology(topology) {}
+
+////////////////////////////////////////////////////////////
+void Topology::Listener::onVertexAdded()
+{
+    size_t count = topology.m_geom.getVerticesCount();
+    topology.addVertices(count - 1, count);
+}
+
+////////////////////////////////////////////////////////////
+void Topology::Listener::onLiaisonAdded()
+{
+    size_t count = topology.m_geom.getLiaisonsCount();
+    topology.addLiaisons(count - 1, count);
+}
+
+////////////////////////////////////////////////////////////
+void Topology::Listener::onFaceAdded()
+{
+    size_t count = topology.m_geom.getFacesCount();
+    topology.addFaces(count - 1, count);
+}
+
+////////////////////////////////////////////////////////////
+void Topology::Listener::onVertexRemoved(size_t)
+{
+    topology.invalidate();
+}
+
+////////////////////////////////////////////////////////////
+void Topology::Listener::onLiaisonRemoved(size_t)
+{
+    topology.invalidate();
+}
+
+////////////////////////////////////////////////////////////
+void Topology::Listener::onFaceRemoved(size_t)
+{
+    topology.invalidate();
+}
+
+////////////////////////////////////////////////////////////
+void Topology::Listener::onErasing()
+{
+    topology.invalidate();
+}
+
+////////////////////////////////////////////////////////////
+void Topology::Listener::onEdited(const Geom::Changes& changes)
+{
+    const Geom& geom = topology.m_geom;
+
+    // Only elements appended after the previous ones keep the tables valid, the
+    // vertices range also growing with moves, which do not change the topology
+    bool appended = (changes.vertices.begin >= changes.vertices.end || changes.vertices.begin >= changes.verticesCount) &&
+                    (changes.liaisons.begin >= changes.liaisons.end || changes.liaisons.begin >= changes.liaisonsCount) &&
+                    (changes.faces.begin >= changes.faces.end || changes.faces.begin >= changes.facesCount) &&
+                    geom.getVerticesCount() >= changes.verticesCount &&
+                    geom.getLiaisonsCount() >= changes.liaisonsCount &&
+                    geom.getFacesCount() >= changes.facesCount;
+
+    if( appended )
+    {
+        topology.addVertices(changes.verticesCount, geom.getVerticesCount());
+        topology.addLiaisons(changes.liaisonsCount, geom.getLiaisonsCount());
+        topology.addFaces(changes.facesCount, geom.getFacesCount());
+    }
+
+    else topology.invalidate();
+}
+
+////////////////////////////////////////////////////////////
+Topology::Indices Topology::Table::get(size_t row) const
+{
+    return Indices{items.data() + begins[row], items.data() + ends[row]};
+}
+
+////////////////////////////////////////////////////////////
+bool Topology::Table::contains(size_t row, size_t item) const
+{
+    return std::find(items.begin() + begins[row], items.begin() + ends[row], item) != items.begin() + ends[row];
+}
+
+////////////////////////////////////////////////////////////
+void Topology::Table::addRow()
+{
+    begins.push_back(items.size());
+    ends.push_back(items.size());
+    limits.push_back(items.size());
+}
+
+////////////////////////////////////////////////////////////
+void Topology::Table::add(size_t row, size_t item)
+{
+    // The old place of a moved row stays unused until the next rebuild
+    if( ends[row] == limits[row] )
+    {
+        size_t size = ends[row] - begins[row], begin = items.size();
+        items.resize(begin + std::max<size_t>(size * 2, 4));
+        std::copy(items.begin() + begins[row], items.begin() + ends[row], items.begin() + begin);
+
+        begins[row] = begin;
+        ends[row] = begin + size;
+        limits[row] = items.size();
+    }
+
+    items[ends[row]++] = item;
+}
+
+////////////////////////////////////////////////////////////
+Topology::Topology(Geom& geom) :
+m_geom(geom),
+m_listener(*this),
+m_updated(false),
+m_boundariesUpdated(false)
+{
+    m_geom.addObserver(m_listener);
+}
+
+////////////////////////////////////////////////////////////
+Topology::~Topology()
+{
+    m_geom.removeObserver(m_listener);
+}
+
+////////////////////////////////////////////////////////////
+const Geom& Topology::getGeom() const
+{
+    return m_geom;
+}
+
+////////////////////////////////////////////////////////////
+Topology::Indices Topology::getNeighbours(size_t vertex) const
+{
+    update();
+
+    return m_neighbours.get(vertex);
+}
+
+////////////////////////////////////////////////////////////
+Topology::Indices Topology::getLiaisons(size_t vertex) const
+{
+    update();
+
+    return m_liaisons.get(vertex);
+}
+
+////////////////////////////////////////////////////////////
+Topology::Indices Topology::getFaces(size_t vertex) const
+{
+    update();
+
+    return m_faces.get(vertex);
+}
+
+////////////////////////////////////////////////////////////
+void Topology::getFaces(size_t vertex1, size_t vertex2, std::vector<size_t>& faces) const
+{
+    faces.clear();
+
+    if( vertex1 == vertex2 )
+        return;
+
+    for( size_t indice : getFaces(vertex1) )
+    {
+        const Face& face = m_geom.getFace(indice);
+
+        if( face.v1.getIndice() == vertex2 || face.v2.getIndice() == vertex2 || face.v3.getIndice() == vertex2 )
+            faces.push_back(indice);
+    }
+}
+
+////////////////////////////////////////////////////////////
+const Liaison* Topology::getLiaison(size_t vertex1, size_t vertex2) const
+{
+    for( size_t indice : getLiaisons(vertex1) )
+    {
+        const Liaison& liaison = m_geom.getLiaison(indice);
+
+        if( (liaison.v1.getIndice() == vertex1 && liaison.v2.getIndice() == vertex2) ||
+            (liaison.v1.getIndice() == vertex2 && liaison.v2.getIndice() == vertex1) )
+            return &liaison;
+    }
+
+    return nullptr;
+}
+
+////////////////////////////////////////////////////////////
+bool Topology::isBoundary(size_t vertex1, size_t vertex2) const
+{
+    if( vertex1 == vertex2 )
+        return false;
+
+    size_t count(0);
+
+    for( size_t indice : getFaces(vertex1) )
+    {
+        const Face& face = m_geom.getFace(indice);
+
+        if( face.v1.getIndice() == vertex2 || face.v2.getIndice() == vertex2 || face.v3.getIndice() == vertex2 )
+            count++;
+    }
+
+    return count == 1;
+}
+
+////////////////////////////////////////////////////////////
+const std::vector<std::vector<size_t>>& Topology::getBoundaries() const
+{
+    if( !m_boundariesUpdated )
+        computeBoundaries();
+
+    return m_boundaries;
+}
+
+////////////////////////////////////////////////////////////
+void Topology::update() const
+{
+    if( m_updated )
+        return;
+
+    size_t verticesCount = m_geom.getVerticesCount(),
+           liaisonsCount = m_geom.getLiaisonsCount(),
+           facesCount = m_geom.getFacesCount();
+
+    std::vector<size_t> rows, items, neighbourRows, neighbourItems;
+
+    rows.reserve(liaisonsCount * 2);
+    items.reserve(liaisonsCount * 2);
+    neighbourRows.reserve(liaisonsCount * 2 + facesCount * 6);
+    neighbourItems.reserve(liaisonsCount * 2 + facesCount * 6);
+
+    for( size_t k(0); k < liaisonsCount; k++ )
+    {
+        const Liaison& liaison = m_geom.getLiaison(k);
+        size_t v1 = liaison.v1.getIndice(), v2 = liaison.v2.getIndice();
+
+        rows.push_back(v1);
+        items.push_back(k);
+
+        if( v1 != v2 )
+        {
+            rows.push_back(v2);
+            items.push_back(k);
+
+            neighbourRows.push_back(v1);
+            neighbourItems.push_back(v2);
+            neighbourRows.push_back(v2);
+            neighbourItems.push_back(v1);
+        }
+    }
+
+    fill(m_liaisons, verticesCount, rows, items);
+
+    rows.clear();
+    items.clear();
+
+    for( size_t k(0); k < facesCount; k++ )
+    {
+        const Face& face = m_geom.getFace(k);
+        size_t v[3] = {face.v1.getIndice(), face.v2.getIndice(), face.v3.getIndice()};
+
+        // A degenerate face is listed once per distinct vertex
+        for( size_t i(0); i < 3; i++ )
+        {
+            if( (i < 1 || v[i] != v[0]) && (i < 2 || v[i] != v[1]) )
+            {
+                rows.push_back(v[i]);
+                items.push_back(k);
+            }
+        }
+
+        for( size_t i(0); i < 3; i++ )
+        {
+            size_t j = (i + 1) % 3;
+
+            if( v[i] != v[j] )
+            {
+                neighbourRows.push_back(v[i]);
+                neighbourItems.push_back(v[j]);
+                neighbourRows.push_back(v[j]);
+                neighbourItems.push_back(v[i]);
+            }
+        }
+    }
+
+    fill(m_faces, verticesCount, rows, items);
+    fill(m_neighbours, verticesCount, neighbourRows, neighbourItems);
+
+    // A vertex shared by several elements is listed once per neighbour
+    size_t count(0);
+
+    for( size_t k(0); k < verticesCount; k++ )
+    {
+        auto begin = m_neighbours.items.begin() + m_neighbours.begins[k],
+             end = m_neighbours.items.begin() + m_neighbours.ends[k];
+
+        std::sort(begin, end);
+        end = std::unique(begin, end);
+
+        m_neighbours.begins[k] = count;
+        count = std::copy(begin, end, m_neighbours.items.begin() + count) - m_neighbours.items.begin();
+        m_neighbours.ends[k] = count;
+        m_neighbours.limits[k] = count;
+    }
+
+    m_neighbours.items.resize(count);
+
+    m_updated = true;
+}
+
+////////////////////////////////////////////////////////////
+void Topology::invalidate()
+{
+    m_updated = false;
+    m_boundariesUpdated = false;
+}
+
+////////////////////////////////////////////////////////////
+void Topology::addVertices(size_t begin, size_t end)
+{
+    if( !m_updated )
+        return;
+
+    for( size_t k(begin); k < end; k++ )
+    {
+        m_neighbours.addRow();
+        m_liaisons.addRow();
+        m_faces.addRow();
+    }
+}
+
+////////////////////////////////////////////////////////////
+void Topology::addLiaisons(size_t begin, size_t end)
+{
+    if( !m_updated )
+        return;
+
+    for( size_t k(begin); k < end; k++ )
+    {
+        const Liaison& liaison = m_geom.getLiaison(k);
+        size_t v1 = liaison.v1.getIndice(), v2 = liaison.v2.getIndice();
+
+        m_liaisons.add(v1, k);
+
+        if( v1 != v2 )
+        {
+            m_liaisons.add(v2, k);
+            addNeighbours(v1, v2);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////
+void Topology::addFaces(size_t begin, size_t end)
+{
+    if( begin < end )
+        m_boundariesUpdated = false;
+
+    if( !m_updated )
+        return;
+
+    for( size_t k(begin); k < end; k++ )
+    {
+        const Face& face = m_geom.getFace(k);
+        size_t v[3] = {face.v1.getIndice(), face.v2.getIndice(), face.v3.getIndice()};
+
+        for( size_t i(0); i < 3; i++ )
+        {
+            if( (i < 1 || v[i] != v[0]) && (i < 2 || v[i] != v[1]) )
+                m_faces.add(v[i], k);
+
+            addNeighbours(v[i], v[(i + 1) % 3]);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////
+void Topology::addNeighbours(size_t vertex1, size_t vertex2)
+{
+    if( vertex1 != vertex2 && !m_neighbours.contains(vertex1, vertex2) )
+    {
+        m_neighbours.add(vertex1, vertex2);
+        m_neighbours.add(vertex2, vertex1);
+    }
+}
+
+////////////////////////////////////////////////////////////
+void Topology::computeBoundaries() const
+{
+    struct Edge { size_t min; size_t max; size_t from; size_t to; };
+
+    std::vector<Edge> edges;
+    edges.reserve(m_geom.getFacesCount() * 3);
+
+    for( size_t k(0); k < m_geom.getFacesCount(); k++ )
+    {
+        const Face& face = m_geom.getFace(k);
+        size_t v[3] = {face.v1.getIndice(), face.v2.getIndice(), face.v3.getIndice()};
+
+        if( v[0] == v[1] || v[1] == v[2] || v[2] == v[0] )
+            continue;
+
+        for( size_t i(0); i < 3; i++ )
+        {
+            size_t from = v[i], to = v[(i + 1) % 3];
+            edges.push_back(Edge{std::min(from, to), std::max(from, to), from, to});
+        }
+    }
+
+    std::sort(edges.begin(), edges.end(), [](const Edge& e1, const Edge& e2)
+    {
+        return e1.min < e2.min || (e1.min == e2.min && e1.max < e2.max);
+    });
+
+    // The edges bordering a single face, oriented like it
+    std::vector<size_t> rows, items;
+
+    for( size_t k(0); k < edges.size(); )
+    {
+        size_t end(k + 1);
+
+        while( end < edges.size() && edges[end].min == edges[k].min && edges[end].max == edges[k].max )
+            end++;
+
+        if( end == k + 1 )
+        {
+            rows.push_back(edges[k].from);
+            items.push_back(edges[k].to);
+        }
+
+        k = end;
+    }
+
+    Table next;
+    fill(next, m_geom.getVerticesCount(), rows, items);
+
+    std::vector<size_t> cursors(next.begins);
+
+    m_boundaries.clear();
+
+    for( size_t k(0); k < cursors.size(); k++ )
+    {
+        while( cursors[k] < next.ends[k] )
+        {
+            std::vector<size_t> loop(1, k);
+            size_t current = next.items[cursors[k]++];
+
+            // Walk until back to the start, or stuck on a non manifold vertex
+            while( current != k )
+            {
+                loop.push_back(current);
+
+                if( cursors[current] == next.ends[current] )
+                    break;
+
+                current = next.items[cursors[current]++];
+            }
+
+            m_boundaries.push_back(loop);
+        }
+    }
+
+    m_boundariesUpdated = true;
+}
+
+////////////////////////////////////////////////////////////
+void Topology::fill(Table& table, size_t rowsCount, const std::vector<size_t>& rows, const std::vector<size_t>& items)
+{
+    std::vector<size_t> offsets(rowsCount + 1, 0);
+
+    for( size_t row : rows )
+        offsets[row + 1]++;
+
+    for( size_t k(0); k < rowsCount; k++ )
+        offsets[k + 1] += offsets[k];
+
+    table.begins.assign(offsets.begin(), offsets.end() - 1);
+    table.ends.assign(offsets.begin() + 1, offsets.end());
+    table.limits = table.ends;
+    table.items.resize(rows.size());
+
+    std::vector<size_t> cursors(table.begins);
+
+    for( size_t k(0); k < rows.size(); k++ )
+        table.items[cursors[rows[k]]++] = items[k];
+}
+
+}
\ No newline at end of file
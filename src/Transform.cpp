@@ -24,6 +24,12 @@
 
 #include <Zoost/Transform.hpp>
 
+#if defined(__AVX__)
+    #include <immintrin.h>
+#elif defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
 namespace zin
 {
     
@@ -37,7 +43,7 @@ Transform::Transform()
 Transform::Transform(double value)
 {
     for( auto& v : m_values )
-        value = v;
+        v = value;
 }
 
 ////////////////////////////////////////////////////////////
@@ -67,7 +73,136 @@ Point Transform::operator*(const Vector2d& vector)
 ////////////////////////////////////////////////////////////
 Point Transform::getMultiplication(const Vector2d& vector)
 {
-    return Vector2d(m_values[0] * vector.x + m_values[1] * vector.y + m_values[2], m_values[3] * vector.x + m_values[4] * vector.y + m_values[5]);
+    Vector2d result(m_values[0] * vector.x + m_values[1] * vector.y + m_values[2], m_values[3] * vector.x + m_values[4] * vector.y + m_values[5]);
+
+    if( !isAffine() )
+        result /= m_values[6] * vector.x + m_values[7] * vector.y + m_values[8];
+
+    return result;
+}
+
+////////////////////////////////////////////////////////////
+void Transform::getMultiplication(const Vector2d* points, Vector2d* results, size_t count) const
+{
+    if( !isAffine() )
+    {
+        for( size_t k = 0; k < count; ++k )
+        {
+            double x = points[k].x, y = points[k].y, w = m_values[6] * x + m_values[7] * y + m_values[8];
+
+            results[k].x = (m_values[0] * x + m_values[1] * y + m_values[2]) / w;
+            results[k].y = (m_values[3] * x + m_values[4] * y + m_values[5]) / w;
+        }
+
+        return;
+    }
+
+    double a = m_values[0], b = m_values[1], c = m_values[2],
+           d = m_values[3], e = m_values[4], f = m_values[5];
+
+    size_t k = 0;
+
+    // The coordinates of a point are contiguous, so the x and y are broadcast
+    // within each point and multiplied by the matching matrix columns
+
+#if defined(__AVX__)
+
+    __m256d column1 = _mm256_set_pd(d, a, d, a), column2 = _mm256_set_pd(e, b, e, b), shift = _mm256_set_pd(f, c, f, c);
+
+    for( ; k + 2 <= count; k+=2 )
+    {
+        __m256d pair = _mm256_loadu_pd(&points[k].x);
+        __m256d x = _mm256_unpacklo_pd(pair, pair), y = _mm256_unpackhi_pd(pair, pair);
+
+        _mm256_storeu_pd(&results[k].x, _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(column1, x), _mm256_mul_pd(column2, y)), shift));
+    }
+
+#elif defined(__SSE2__)
+
+    __m128d column1 = _mm_set_pd(d, a), column2 = _mm_set_pd(e, b), shift = _mm_set_pd(f, c);
+
+    for( ; k < count; ++k )
+    {
+        __m128d point = _mm_loadu_pd(&points[k].x);
+        __m128d x = _mm_unpacklo_pd(point, point), y = _mm_unpackhi_pd(point, point);
+
+        _mm_storeu_pd(&results[k].x, _mm_add_pd(_mm_add_pd(_mm_mul_pd(column1, x), _mm_mul_pd(column2, y)), shift));
+    }
+
+#endif
+
+    for( ; k < count; ++k )
+    {
+        double x = points[k].x, y = points[k].y;
+
+        results[k].x = a * x + b * y + c;
+        results[k].y = d * x + e * y + f;
+    }
+}
+
+////////////////////////////////////////////////////////////
+void Transform::getMultiplication(const double* pointsX, const double* pointsY, double* resultsX, double* resultsY, size_t count) const
+{
+    if( !isAffine() )
+    {
+        for( size_t k = 0; k < count; ++k )
+        {
+            double x = pointsX[k], y = pointsY[k], w = m_values[6] * x + m_values[7] * y + m_values[8];
+
+            resultsX[k] = (m_values[0] * x + m_values[1] * y + m_values[2]) / w;
+            resultsY[k] = (m_values[3] * x + m_values[4] * y + m_values[5]) / w;
+        }
+
+        return;
+    }
+
+    double a = m_values[0], b = m_values[1], c = m_values[2],
+           d = m_values[3], e = m_values[4], f = m_values[5];
+
+    size_t k = 0;
+
+#if defined(__AVX__)
+
+    __m256d A = _mm256_set1_pd(a), B = _mm256_set1_pd(b), C = _mm256_set1_pd(c),
+            D = _mm256_set1_pd(d), E = _mm256_set1_pd(e), F = _mm256_set1_pd(f);
+
+    for( ; k + 4 <= count; k+=4 )
+    {
+        __m256d x = _mm256_loadu_pd(pointsX + k), y = _mm256_loadu_pd(pointsY + k);
+
+        _mm256_storeu_pd(resultsX + k, _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(A, x), _mm256_mul_pd(B, y)), C));
+        _mm256_storeu_pd(resultsY + k, _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(D, x), _mm256_mul_pd(E, y)), F));
+    }
+
+#elif defined(__SSE2__)
+
+    __m128d A = _mm_set1_pd(a), B = _mm_set1_pd(b), C = _mm_set1_pd(c),
+            D = _mm_set1_pd(d), E = _mm_set1_pd(e), F = _mm_set1_pd(f);
+
+    for( ; k + 2 <= count; k+=2 )
+    {
+        __m128d x = _mm_loadu_pd(pointsX + k), y = _mm_loadu_pd(pointsY + k);
+
+        _mm_storeu_pd(resultsX + k, _mm_add_pd(_mm_add_pd(_mm_mul_pd(A, x), _mm_mul_pd(B, y)), C));
+        _mm_storeu_pd(resultsY + k, _mm_add_pd(_mm_add_pd(_mm_mul_pd(D, x), _mm_mul_pd(E, y)), F));
+    }
+
+#endif
+
+    for( ; k < count; ++k )
+    {
+        double x = pointsX[k], y = pointsY[k];
+
+        resultsX[k] = a * x + b * y + c;
+        resultsY[k] = d * x + e * y + f;
+    }
+}
+
+////////////////////////////////////////////////////////////
+void Transform::getMultiplication(const std::vector<Vector2d>& points, std::vector<Vector2d>& results) const
+{
+    results.resize(points.size());
+    getMultiplication(points.data(), results.data(), points.size());
 }
 
 ////////////////////////////////////////////////////////////
@@ -94,7 +229,23 @@ Transform& Transform::operator*=(const Transform& transformation)
 ////////////////////////////////////////////////////////////
 Transform& Transform::multiply(const Transform& transformation)
 {
+    if( &transformation == this )
+        return multiply(Transform(m_values));
+
     std::array<double, 9> temp = m_values;
+
+    // The bottom rows stay (0, 0, 1), only the upper 2x3 parts are combined
+    if( isAffine() && transformation.isAffine() )
+    {
+        m_values[0] = temp[0] * transformation[0] + temp[1] * transformation[3];
+        m_values[1] = temp[0] * transformation[1] + temp[1] * transformation[4];
+        m_values[2] = temp[0] * transformation[2] + temp[1] * transformation[5] + temp[2];
+        m_values[3] = temp[3] * transformation[0] + temp[4] * transformation[3];
+        m_values[4] = temp[3] * transformation[1] + temp[4] * transformation[4];
+        m_values[5] = temp[3] * transformation[2] + temp[4] * transformation[5] + temp[5];
+
+        return *this;
+    }
     
     m_values[0] = temp[0] * transformation[0] + temp[1] * transformation[3] + temp[2] * transformation[6];
     m_values[1] = temp[0] * transformation[1] + temp[1] * transformation[4] + temp[2] * transformation[7];
@@ -140,6 +291,18 @@ Transform Transform::getInverse()
     Transform inverse;
     
     const double det = getDeterminant();
+
+    if( isAffine() )
+    {
+        inverse[0] =  m_values[4] / det;
+        inverse[1] = -m_values[1] / det;
+        inverse[3] = -m_values[3] / det;
+        inverse[4] =  m_values[0] / det;
+        inverse[2] = -(inverse[0] * m_values[2] + inverse[1] * m_values[5]);
+        inverse[5] = -(inverse[3] * m_values[2] + inverse[4] * m_values[5]);
+
+        return inverse;
+    }
     
     inverse[0] =  (m_values[4] * m_values[8] - m_values[7] * m_values[5]) / det;
     inverse[1] = -(m_values[1] * m_values[8] - m_values[7] * m_values[2]) / det;
@@ -157,16 +320,24 @@ Transform Transform::getInverse()
 ////////////////////////////////////////////////////////////
 double* Transform::getValues()
 {
-    double values[9] = {m_values[0], m_values[1], m_values[2], m_values[3], m_values[4], m_values[5], m_values[6], m_values[7], m_values[8]};
-    return values;
+    return m_values.data();
 }
 
 ////////////////////////////////////////////////////////////
 double Transform::getDeterminant()
 {
+    if( isAffine() )
+        return m_values[0] * m_values[4] - m_values[1] * m_values[3];
+
     return m_values[0] * (m_values[4] * m_values[8] - m_values[7] * m_values[5]) -
            m_values[1] * (m_values[3] * m_values[8] - m_values[6] * m_values[5]) +
-           m_values[2] * (m_values[3] * m_values[8] - m_values[6] * m_values[5]);
+           m_values[2] * (m_values[3] * m_values[7] - m_values[6] * m_values[4]);
+}
+
+////////////////////////////////////////////////////////////
+bool Transform::isAffine() const
+{
+    return m_values[6] == 0 && m_values[7] == 0 && m_values[8] == 1;
 }
     
 ////////////////////////////////////////////////////////////
@@ -23,6 +23,8 @@
 ////////////////////////////////////////////////////////////
 
 #include <Zoost/Transformable.hpp>
+#include <algorithm>
+#include <cmath>
 
 namespace zin
 {
@@ -33,30 +35,103 @@ m_position(position),
 m_rotation(rotation),
 m_scale(scale) {}
 
+////////////////////////////////////////////////////////////
+Transformable::Transformable(const Transformable& transformable) :
+m_origin(transformable.m_origin),
+m_position(transformable.m_position),
+m_scale(transformable.m_scale),
+m_rotation(transformable.m_rotation) {}
+
+////////////////////////////////////////////////////////////
+Transformable::~Transformable()
+{
+    if( m_parent )
+    {
+        auto& siblings = m_parent->m_children;
+        siblings.erase(std::find(siblings.begin(), siblings.end(), this));
+    }
+
+    for( auto& child : m_children )
+    {
+        child->m_parent = nullptr;
+        child->invalidateGlobalTransform();
+    }
+}
+
 ////////////////////////////////////////////////////////////
 Transformable& Transformable::operator=(const Transformable& transformable)
 {
-    m_transform           = transformable.m_transform;
-    m_invTransform        = transformable.m_invTransform;
-    m_transformUpdated    = transformable.m_transformUpdated;
-    m_invTransformUpdated = transformable.m_invTransformUpdated;
-    m_origin              = transformable.m_origin;
-    m_position            = transformable.m_position;
-    m_scale               = transformable.m_scale;
-    m_rotation            = transformable.m_rotation;
-}  
+    m_origin   = transformable.m_origin;
+    m_position = transformable.m_position;
+    m_scale    = transformable.m_scale;
+    m_rotation = transformable.m_rotation;
+
+    invalidateTransform();
+
+    return *this;
+}
+
+////////////////////////////////////////////////////////////
+void Transformable::setParent(Transformable* parent)
+{
+    if( parent == m_parent )
+        return;
+
+    // A transformable can't be its own ancestor
+    for( Transformable* ancestor = parent; ancestor; ancestor = ancestor->m_parent )
+    {
+        if( ancestor == this )
+            return;
+    }
+
+    if( m_parent )
+    {
+        auto& siblings = m_parent->m_children;
+        siblings.erase(std::find(siblings.begin(), siblings.end(), this));
+    }
+
+    m_parent = parent;
+
+    if( m_parent )
+        m_parent->m_children.push_back(this);
+
+    invalidateGlobalTransform();
+}
+
+////////////////////////////////////////////////////////////
+Transformable* Transformable::getParent() const
+{
+    return m_parent;
+}
+
+////////////////////////////////////////////////////////////
+void Transformable::addChild(Transformable& child)
+{
+    child.setParent(this);
+}
+
+////////////////////////////////////////////////////////////
+void Transformable::removeChild(Transformable& child)
+{
+    if( child.m_parent == this )
+        child.setParent(nullptr);
+}
+
+////////////////////////////////////////////////////////////
+const std::vector<Transformable*>& Transformable::getChildren() const
+{
+    return m_children;
+}
 
 ////////////////////////////////////////////////////////////
 void Transformable::init()
 {
-    m_transform.init();
-    m_invTransform.init();
-    m_transformUpdated    = true;
-    m_invTransformUpdated = true;
-    m_origin              = Point();
-    m_position            = Coords();
-    m_scale               = Vector2d(1, 1);
-    m_rotation            = 0;
+    m_origin   = Point();
+    m_position = Coords();
+    m_scale    = Vector2d(1, 1);
+    m_rotation = 0;
+
+    invalidateTransform();
 }
 
 ////////////////////////////////////////////////////////////
@@ -64,8 +139,7 @@ void Transformable::setPositionX(double posX)
 {
     m_position.x = posX;
     
-    m_transformUpdated    = false;
-    m_invTransformUpdated = false;
+    invalidateTransform();
 }
 
 ////////////////////////////////////////////////////////////
@@ -73,8 +147,7 @@ void Transformable::setPositionY(double posY)
 {
     m_position.y = posY;
     
-    m_transformUpdated    = false;
-    m_invTransformUpdated = false;
+    invalidateTransform();
 }
 
 ////////////////////////////////////////////////////////////
@@ -139,8 +212,7 @@ void Transformable::setRotation(double angle)
 {
     m_rotation = angle;
     
-    m_transformUpdated    = false;
-    m_invTransformUpdated = false;
+    invalidateTransform();
 }
 
 ////////////////////////////////////////////////////////////
@@ -162,8 +234,7 @@ void Transformable::setScaleX(double factorX)
     {
         m_scale.x = factorX;
         
-        m_transformUpdated    = false;
-        m_invTransformUpdated = false;
+        invalidateTransform();
     }
 }
 
@@ -174,8 +245,7 @@ void Transformable::setScaleY(double factorY)
     {
         m_scale.y = factorY;
     
-        m_transformUpdated    = false;
-        m_invTransformUpdated = false;
+        invalidateTransform();
     }
 }
 
@@ -229,8 +299,7 @@ void Transformable::setOrigin(double x,double y)
     m_origin.x = x;
     m_origin.y = y;
 
-    m_transformUpdated    = false;
-    m_invTransformUpdated = false;
+    invalidateTransform();
 }
 
 
@@ -270,6 +339,24 @@ Rect Transformable::convertToGlobal(const Rect& rect) const
     return Rect(convertToGlobal(rect.pos), rect.size);
 }
 
+////////////////////////////////////////////////////////////
+void Transformable::convertToGlobal(const Point* points, Point* results, size_t count) const
+{
+    getTransform().getMultiplication(points, results, count);
+}
+
+////////////////////////////////////////////////////////////
+void Transformable::convertToGlobal(const double* pointsX, const double* pointsY, double* resultsX, double* resultsY, size_t count) const
+{
+    getTransform().getMultiplication(pointsX, pointsY, resultsX, resultsY, count);
+}
+
+////////////////////////////////////////////////////////////
+void Transformable::convertToGlobal(std::vector<Point>& points) const
+{
+    convertToGlobal(points.data(), points.data(), points.size());
+}
+
 ////////////////////////////////////////////////////////////
 Point Transformable::convertToLocal(const Point& point) const
 {
@@ -294,20 +381,88 @@ Rect Transformable::convertToLocal(const Rect& rect) const
     return Rect(convertToLocal(rect.pos), rect.size);
 }
 
+////////////////////////////////////////////////////////////
+void Transformable::convertToLocal(const Point* points, Point* results, size_t count) const
+{
+    getInvTransform().getMultiplication(points, results, count);
+}
+
+////////////////////////////////////////////////////////////
+void Transformable::convertToLocal(const double* pointsX, const double* pointsY, double* resultsX, double* resultsY, size_t count) const
+{
+    getInvTransform().getMultiplication(pointsX, pointsY, resultsX, resultsY, count);
+}
+
+////////////////////////////////////////////////////////////
+void Transformable::convertToLocal(std::vector<Point>& points) const
+{
+    convertToLocal(points.data(), points.data(), points.size());
+}
+
+////////////////////////////////////////////////////////////
+Transform& Transformable::getLocalTransform() const
+{
+    if( !m_localTransformUpdated )
+    {
+        // Translation * rotation around the origin * scaling around the origin, in closed form
+        double cosine = std::cos(m_rotation), sine = std::sin(m_rotation);
+        double a = cosine * m_scale.x, b = -sine * m_scale.y,
+               d = sine * m_scale.x, e =  cosine * m_scale.y;
+
+        m_localTransform.init();
+        m_localTransform[0] = a;
+        m_localTransform[1] = b;
+        m_localTransform[2] = m_position.x + m_origin.x - (a * m_origin.x + b * m_origin.y);
+        m_localTransform[3] = d;
+        m_localTransform[4] = e;
+        m_localTransform[5] = m_position.y + m_origin.y - (d * m_origin.x + e * m_origin.y);
+        m_localTransformUpdated = true;
+    }
+    
+    return m_localTransform;
+}
+
 ////////////////////////////////////////////////////////////
 Transform& Transformable::getTransform() const
 {
     if( !m_transformUpdated )
     {
-        m_transform = Transform::translation(m_position) * Transform::rotation(m_rotation, m_origin) * Transform::scaling(m_scale, m_origin);
-        m_transformUpdated = true;
+        if( m_parent )
+            m_transform = m_parent->getTransform() * getLocalTransform();
+
+        else
+            m_transform = getLocalTransform();
 
-        onTransformUpdated();
+        m_transformUpdated = true;
     }
     
     return m_transform;
 }
 
+////////////////////////////////////////////////////////////
+void Transformable::invalidateTransform()
+{
+    m_localTransformUpdated = false;
+
+    invalidateGlobalTransform();
+}
+
+////////////////////////////////////////////////////////////
+void Transformable::invalidateGlobalTransform()
+{
+    // An outdated transform has outdated descendants, all already notified
+    if( !m_transformUpdated )
+        return;
+
+    m_transformUpdated    = false;
+    m_invTransformUpdated = false;
+
+    onTransformUpdated();
+
+    for( auto& child : m_children )
+        child->invalidateGlobalTransform();
+}
+
 ////////////////////////////////////////////////////////////
 Transform& Transformable::getInvTransform() const
 {
@@ -24,6 +24,12 @@
 
 #include <Zoost/Triangle.hpp>
 
+#if defined(__AVX__)
+    #include <immintrin.h>
+#elif defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
 namespace zin
 {
 
@@ -52,4 +58,78 @@ bool Triangle::contains(const Point& point1, const Point& point2, const Point& p
     return triangle.contains(point);
 }
 
+////////////////////////////////////////////////////////////
+void Triangle::contains(const Point& p1, const Point& p2, const Point& p3, const double* pointsX, const double* pointsY, size_t count, Uint8* results)
+{
+    double d1 = p2.y - p1.y, d2 = p1.x - p2.x, d3 = p1.y*p2.x - p1.x*p2.y,
+           d4 = p2.y - p3.y, d5 = p3.x - p2.x, d6 = p3.y*p2.x - p3.x*p2.y,
+           d7 = p3.y - p1.y, d8 = p1.x - p3.x, d9 = p1.y*p3.x - p1.x*p3.y;
+
+    double s1 = d1*p3.x + d2*p3.y + d3,
+           s2 = d4*p1.x + d5*p1.y + d6,
+           s3 = d7*p2.x + d8*p2.y + d9;
+
+    size_t k = 0;
+
+#if defined(__AVX__)
+
+    __m256d D1 = _mm256_set1_pd(d1), D2 = _mm256_set1_pd(d2), D3 = _mm256_set1_pd(d3),
+            D4 = _mm256_set1_pd(d4), D5 = _mm256_set1_pd(d5), D6 = _mm256_set1_pd(d6),
+            D7 = _mm256_set1_pd(d7), D8 = _mm256_set1_pd(d8), D9 = _mm256_set1_pd(d9),
+            S1 = _mm256_set1_pd(s1), S2 = _mm256_set1_pd(s2), S3 = _mm256_set1_pd(s3),
+            zero = _mm256_setzero_pd();
+
+    for( ; k + 4 <= count; k+=4 )
+    {
+        __m256d x = _mm256_loadu_pd(pointsX + k), y = _mm256_loadu_pd(pointsY + k);
+
+        __m256d e1 = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(D1, x), _mm256_mul_pd(D2, y)), D3),
+                e2 = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(D4, x), _mm256_mul_pd(D5, y)), D6),
+                e3 = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(D7, x), _mm256_mul_pd(D8, y)), D9);
+
+        int mask = _mm256_movemask_pd(_mm256_and_pd(_mm256_and_pd(_mm256_cmp_pd(_mm256_mul_pd(S1, e1), zero, _CMP_GE_OQ),
+                                                                  _mm256_cmp_pd(_mm256_mul_pd(S2, e2), zero, _CMP_GE_OQ)),
+                                                                  _mm256_cmp_pd(_mm256_mul_pd(S3, e3), zero, _CMP_GT_OQ)));
+
+        results[k    ] |= (mask     ) & 1;
+        results[k + 1] |= (mask >> 1) & 1;
+        results[k + 2] |= (mask >> 2) & 1;
+        results[k + 3] |= (mask >> 3) & 1;
+    }
+
+#elif defined(__SSE2__)
+
+    __m128d D1 = _mm_set1_pd(d1), D2 = _mm_set1_pd(d2), D3 = _mm_set1_pd(d3),
+            D4 = _mm_set1_pd(d4), D5 = _mm_set1_pd(d5), D6 = _mm_set1_pd(d6),
+            D7 = _mm_set1_pd(d7), D8 = _mm_set1_pd(d8), D9 = _mm_set1_pd(d9),
+            S1 = _mm_set1_pd(s1), S2 = _mm_set1_pd(s2), S3 = _mm_set1_pd(s3),
+            zero = _mm_setzero_pd();
+
+    for( ; k + 2 <= count; k+=2 )
+    {
+        __m128d x = _mm_loadu_pd(pointsX + k), y = _mm_loadu_pd(pointsY + k);
+
+        __m128d e1 = _mm_add_pd(_mm_add_pd(_mm_mul_pd(D1, x), _mm_mul_pd(D2, y)), D3),
+                e2 = _mm_add_pd(_mm_add_pd(_mm_mul_pd(D4, x), _mm_mul_pd(D5, y)), D6),
+                e3 = _mm_add_pd(_mm_add_pd(_mm_mul_pd(D7, x), _mm_mul_pd(D8, y)), D9);
+
+        int mask = _mm_movemask_pd(_mm_and_pd(_mm_and_pd(_mm_cmpge_pd(_mm_mul_pd(S1, e1), zero),
+                                                         _mm_cmpge_pd(_mm_mul_pd(S2, e2), zero)),
+                                                         _mm_cmpgt_pd(_mm_mul_pd(S3, e3), zero)));
+
+        results[k    ] |= (mask     ) & 1;
+        results[k + 1] |= (mask >> 1) & 1;
+    }
+
+#endif
+
+    for( ; k < count; k++ )
+    {
+        double x = pointsX[k], y = pointsY[k];
+
+        if( s1*(d1*x + d2*y + d3) >= 0 && s2*(d4*x + d5*y + d6) >= 0 && s3*(d7*x + d8*y + d9) > 0 )
+            results[k] = 1;
+    }
+}
+
 }
\ No newline at end of file
@@ -0,0 +1,432 @@
+////////////////////////////////////////////////////////////
+//
+// Zoost C++ library
+// Copyright (C) 2011-2012 Pierre-Emmanuel BRIAN (zinlibs@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#include <Zoost/Triangulation.hpp>
+#include <Zoost/Math.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace zin
+{
+
+namespace Triangulation
+{
+
+////////////////////////////////////////////////////////////
+void ZOOST_API earClipping(const Point* points, size_t count, std::vector<size_t>& triangles)
+{
+    std::vector<size_t> ring(count);
+
+    for( size_t k(0); k < count; k++ )
+        ring[k] = k;
+
+    earClipping(points, ring, triangles);
+}
+
+////////////////////////////////////////////////////////////
+void ZOOST_API earClipping(const Point* points, const std::vector<size_t>& ring, std::vector<size_t>& triangles)
+{
+    size_t count = ring.size();
+
+    if( count < 3 )
+        return;
+
+    double area = 0;
+
+    for( size_t k(0); k < count; k++ )
+    {
+        const Point& p1 = points[ring[k]], & p2 = points[ring[(k + 1) % count]];
+        area+=(p1.x*p2.y - p2.x*p1.y);
+    }
+
+    // The ears are clipped in the winding of the ring, the tests are made counterclockwise
+    double orientation = area < 0 ? -1 : 1;
+
+    auto side = [orientation](const Point& a, const Point& b, const Point& c)
+    {
+        return ((b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x)) * orientation;
+    };
+
+    std::vector<size_t> prev(count), next(count);
+    std::vector<Uint8> reflex(count);
+
+    double minX = points[ring[0]].x, maxX = minX,
+           minY = points[ring[0]].y, maxY = minY;
+
+    size_t reflexCount(0);
+
+    for( size_t k(0); k < count; k++ )
+    {
+        prev[k] = k == 0 ? count - 1 : k - 1;
+        next[k] = k + 1 == count ? 0 : k + 1;
+
+        const Point& point = points[ring[k]];
+
+        reflex[k] = side(points[ring[prev[k]]], point, points[ring[next[k]]]) <= 0;
+        reflexCount+=reflex[k];
+
+        minX = std::min(minX, point.x);
+        maxX = std::max(maxX, point.x);
+        minY = std::min(minY, point.y);
+        maxY = std::max(maxY, point.y);
+    }
+
+    // Only the reflex vertices can lie inside an ear, they are spread in a grid of about one per cell,
+    // rebuilt whenever half of them are no longer reflex
+    size_t cells(1);
+    double cellWidth(1), cellHeight(1);
+    std::vector<size_t> offsets, items;
+
+    auto column = [&](double x) { return std::min(cells - 1, size_t((x - minX) / cellWidth)); };
+    auto row = [&](double y) { return std::min(cells - 1, size_t((y - minY) / cellHeight)); };
+
+    auto buildGrid = [&]()
+    {
+        cells = std::max(size_t(1), size_t(std::sqrt(double(reflexCount))));
+        cellWidth = maxX > minX ? (maxX - minX) / cells : 1;
+        cellHeight = maxY > minY ? (maxY - minY) / cells : 1;
+
+        offsets.assign(cells * cells + 1, 0);
+        items.resize(reflexCount);
+
+        for( size_t k(0); k < count; k++ )
+        {
+            if( reflex[k] )
+                offsets[row(points[ring[k]].y) * cells + column(points[ring[k]].x) + 1]++;
+        }
+
+        for( size_t k(0); k < cells * cells; k++ )
+            offsets[k + 1]+=offsets[k];
+
+        std::vector<size_t> cursors(offsets.begin(), offsets.end() - 1);
+
+        for( size_t k(0); k < count; k++ )
+        {
+            if( reflex[k] )
+                items[cursors[row(points[ring[k]].y) * cells + column(points[ring[k]].x)]++] = k;
+        }
+    };
+
+    buildGrid();
+
+    auto isEar = [&](size_t b)
+    {
+        size_t a = prev[b], c = next[b];
+        const Point& A = points[ring[a]], & B = points[ring[b]], & C = points[ring[c]];
+
+        if( side(A, B, C) <= 0 )
+            return false;
+
+        size_t column1 = column(std::min(A.x, std::min(B.x, C.x))), column2 = column(std::max(A.x, std::max(B.x, C.x))),
+               row1 = row(std::min(A.y, std::min(B.y, C.y))), row2 = row(std::max(A.y, std::max(B.y, C.y)));
+
+        for( size_t i(row1); i <= row2; i++ )
+        {
+            for( size_t j(column1); j <= column2; j++ )
+            {
+                size_t cell = i * cells + j;
+
+                for( size_t k(offsets[cell]); k < offsets[cell + 1]; k++ )
+                {
+                    size_t s = items[k];
+
+                    // The vertices clipped or become convex are left in the grid, but no longer flagged
+                    if( !reflex[s] || s == a || s == b || s == c )
+                        continue;
+
+                    const Point& P = points[ring[s]];
+
+                    if( P == A || P == B || P == C )
+                        continue;
+
+                    if( side(A, B, P) >= 0 && side(B, C, P) >= 0 && side(C, A, P) >= 0 )
+                        return false;
+                }
+            }
+        }
+
+        return true;
+    };
+
+    triangles.reserve(triangles.size() + (count - 2) * 3);
+
+    std::vector<Uint8> removed(count, false);
+
+    auto clip = [&](size_t b)
+    {
+        size_t a = prev[b], c = next[b];
+
+        if( side(points[ring[a]], points[ring[b]], points[ring[c]]) != 0 )
+        {
+            triangles.push_back(ring[a]);
+            triangles.push_back(ring[b]);
+            triangles.push_back(ring[c]);
+        }
+
+        next[a] = c;
+        prev[c] = a;
+        removed[b] = true;
+
+        if( reflex[b] )
+        {
+            reflex[b] = false;
+            reflexCount--;
+        }
+
+        if( reflex[a] && side(points[ring[prev[a]]], points[ring[a]], points[ring[c]]) > 0 )
+        {
+            reflex[a] = false;
+            reflexCount--;
+        }
+
+        if( reflex[c] && side(points[ring[a]], points[ring[c]], points[ring[next[c]]]) > 0 )
+        {
+            reflex[c] = false;
+            reflexCount--;
+        }
+
+        if( reflexCount * 2 < items.size() )
+            buildGrid();
+    };
+
+    // Clipping an ear only changes its neighbours, which are queued again, the whole ring being queued
+    // only when the queue runs dry
+    std::vector<size_t> queue;
+    size_t remaining = count, start = 0, head = 0;
+    bool clipped = true;
+
+    while( remaining > 3 )
+    {
+        if( head == queue.size() )
+        {
+            queue.clear();
+            head = 0;
+
+            // A whole turn without ear, the ring is not simple, it is forced through
+            if( !clipped )
+            {
+                size_t current = start;
+
+                while( side(points[ring[prev[current]]], points[ring[current]], points[ring[next[current]]]) < 0 && next[current] != start )
+                    current = next[current];
+
+                queue.push_back(prev[current]);
+                queue.push_back(next[current]);
+                start = next[current];
+
+                clip(current);
+                remaining--;
+                continue;
+            }
+
+            size_t current = start;
+
+            do
+            {
+                queue.push_back(current);
+                current = next[current];
+            }
+            while( current != start );
+
+            clipped = false;
+        }
+
+        size_t current = queue[head++];
+
+        if( removed[current] || !isEar(current) )
+            continue;
+
+        queue.push_back(prev[current]);
+        queue.push_back(next[current]);
+        start = next[current];
+
+        clip(current);
+        remaining--;
+        clipped = true;
+    }
+
+    if( side(points[ring[prev[start]]], points[ring[start]], points[ring[next[start]]]) != 0 )
+    {
+        triangles.push_back(ring[prev[start]]);
+        triangles.push_back(ring[start]);
+        triangles.push_back(ring[next[start]]);
+    }
+}
+
+////////////////////////////////////////////////////////////
+void ZOOST_API earClipping(const Point* points, const std::vector<std::vector<size_t>>& rings, std::vector<size_t>& triangles)
+{
+    std::vector<size_t> ring;
+    bridge(points, rings, ring);
+
+    earClipping(points, ring, triangles);
+}
+
+////////////////////////////////////////////////////////////
+void ZOOST_API bridge(const Point* points, const std::vector<std::vector<size_t>>& rings, std::vector<size_t>& ring)
+{
+    ring.clear();
+
+    if( rings.empty() )
+        return;
+
+    auto getArea = [&](const std::vector<size_t>& indices)
+    {
+        double area = 0;
+
+        for( size_t k(0); k < indices.size(); k++ )
+        {
+            const Point& p1 = points[indices[k]], & p2 = points[indices[(k + 1) % indices.size()]];
+            area+=(p1.x*p2.y - p2.x*p1.y);
+        }
+
+        return area;
+    };
+
+    auto side = [](const Point& a, const Point& b, const Point& c)
+    {
+        return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+    };
+
+    ring = rings[0];
+
+    // The outer ring is made counterclockwise & the holes clockwise, then everything is turned back if needed
+    bool reversed = getArea(ring) < 0;
+
+    if( reversed )
+        std::reverse(ring.begin(), ring.end());
+
+    // Each hole is joined from its rightmost vertex, the rightmost holes first
+    std::vector<std::pair<double, size_t>> holes;
+
+    for( size_t k(1); k < rings.size(); k++ )
+    {
+        if( rings[k].size() < 3 )
+            continue;
+
+        size_t right(0);
+
+        for( size_t i(1); i < rings[k].size(); i++ )
+        {
+            if( points[rings[k][i]].x > points[rings[k][right]].x )
+                right = i;
+        }
+
+        holes.push_back(std::make_pair(-points[rings[k][right]].x, k));
+    }
+
+    std::sort(holes.begin(), holes.end());
+
+    for( auto& entry : holes )
+    {
+        std::vector<size_t> hole = rings[entry.second];
+
+        if( getArea(hole) > 0 )
+            std::reverse(hole.begin(), hole.end());
+
+        size_t right(0);
+
+        for( size_t i(1); i < hole.size(); i++ )
+        {
+            if( points[hole[i]].x > points[hole[right]].x )
+                right = i;
+        }
+
+        const Point& h = points[hole[right]];
+        size_t count = ring.size(), found = count;
+        double nearest = 0;
+
+        // Cast a ray to the right, it leaves the ring through an upward edge
+        for( size_t k(0); k < count; k++ )
+        {
+            const Point& p = points[ring[k]], & q = points[ring[(k + 1) % count]];
+
+            if( p.y <= h.y && h.y <= q.y && p.y != q.y )
+            {
+                double x = p.x + (h.y - p.y) * (q.x - p.x) / (q.y - p.y);
+
+                if( x >= h.x && (found == count || x < nearest) )
+                {
+                    nearest = x;
+                    found = p.x > q.x ? k : (k + 1) % count;
+                }
+            }
+        }
+
+        // The hole lies outside the ring
+        if( found == count )
+            continue;
+
+        // A vertex inside the triangle between the hole, the hit & the edge end may hide the latter,
+        // then the one closest to the ray is taken
+        const Point& m = points[ring[found]];
+        size_t target = found;
+        double tangentMin = -1;
+
+        for( size_t k(0); k < count; k++ )
+        {
+            const Point& p = points[ring[k]];
+
+            if( p.x <= h.x || p.x > m.x || k == found )
+                continue;
+
+            Point hit(nearest, h.y);
+            double side1 = side(h, hit, p), side2 = side(hit, m, p), side3 = side(m, h, p);
+
+            if( (side1 < 0 || side2 < 0 || side3 < 0) && (side1 > 0 || side2 > 0 || side3 > 0) )
+                continue;
+
+            const Point& prev = points[ring[(k + count - 1) % count]], & next = points[ring[(k + 1) % count]];
+
+            // The bridge must leave the vertex towards the inside of the ring
+            bool inside = side(prev, p, next) > 0 ? side(p, next, h) >= 0 && side(prev, p, h) >= 0 :
+                                                    side(p, next, h) > 0 || side(prev, p, h) > 0;
+
+            double tangent = Math::abs(h.y - p.y) / (p.x - h.x);
+
+            if( inside && (tangentMin < 0 || tangent < tangentMin || (tangent == tangentMin && p.x < points[ring[target]].x)) )
+            {
+                target = k;
+                tangentMin = tangent;
+            }
+        }
+
+        // The ring goes to the hole & comes back along the bridge, both ends being repeated
+        std::vector<size_t> splice;
+        splice.reserve(hole.size() + 2);
+
+        for( size_t k(0); k <= hole.size(); k++ )
+            splice.push_back(hole[(right + k) % hole.size()]);
+
+        splice.push_back(ring[target]);
+        ring.insert(ring.begin() + target + 1, splice.begin(), splice.end());
+    }
+
+    if( reversed )
+        std::reverse(ring.begin(), ring.end());
+}
+
+}
+
+}
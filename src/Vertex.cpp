@@ -32,36 +32,32 @@ namespace zin
 Vertex& Vertex::operator=(const Coords& coords)
 {
     setCoords(coords);
+    return *this;
 }
 
 ////////////////////////////////////////////////////////////   
 void Vertex::setCoords(const Coords& coords)
 {
-    m_coords = coords;
-    m_geom.onVertexMoved();
+    m_geom->m_coordsX[m_indice] = coords.x;
+    m_geom->m_coordsY[m_indice] = coords.y;
+    m_geom->onVertexMoved(m_indice);
 }
 
 ////////////////////////////////////////////////////////////   
-const Coords& Vertex::getCoords() const
+Coords Vertex::getCoords() const
 {
-    return m_coords;
+    return Coords(m_geom->m_coordsX[m_indice], m_geom->m_coordsY[m_indice]);
 }
 
 ////////////////////////////////////////////////////////////   
 size_t Vertex::getIndice() const
 {
-    size_t k = 0;
-
-    for( ; k < m_geom.getVerticesCount(); k++ )
-        if( this == &m_geom.getVertex(k) )
-            break;
-
-    return k;
+    return m_indice;
 }
 
 ////////////////////////////////////////////////////////////
-Vertex::Vertex(const Coords& coords, const Geom& geom) :
-m_coords(coords),
-m_geom(geom) {}
+Vertex::Vertex(size_t indice, const Geom& geom) :
+m_geom(&geom),
+m_indice(indice) {}
 
 }
\ No newline at end of file
@@ -0,0 +1,104 @@
+////////////////////////////////////////////////////////////
+//
+// Zoost C++ library
+// Copyright (C) 2011-2012 Pierre-Emmanuel BRIAN (zinlibs@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#include <Zoost/Curve.hpp>
+#include <algorithm>
+#include <cmath>
+#include "Check.hpp"
+
+using namespace zin;
+
+////////////////////////////////////////////////////////////
+// Check if two values are equal up to the rounding errors
+////////////////////////////////////////////////////////////
+bool near(double value1, double value2)
+{
+    return std::fabs(value1 - value2) < 1e-9;
+}
+
+////////////////////////////////////////////////////////////
+int main()
+{
+    // Replacing the end of a measured curve, the liaisons count being back to the same
+    {
+        Curve curve{Point(0, 0), Point(1, 0), Point(2, 0)};
+        CHECK(near(curve.getLength(), 2));
+
+        curve.removeVertex(curve.getVertex(2));
+        curve.addVertex(Point(101, 0));
+
+        CHECK(near(curve.getLength(), 101));
+        CHECK(near(curve[0.5].x, 50.5));
+        CHECK(near(curve[1].x, 101));
+    }
+
+    // Same with a liaison removed through the geom
+    {
+        Curve curve{Point(0, 0), Point(0, 1), Point(0, 2)};
+        CHECK(near(curve.getLength(), 2));
+
+        static_cast<Geom&>(curve).removeLiaison(curve.getLiaison(1));
+        curve.addVertex(Point(0, 10));
+
+        CHECK(near(curve.getLength(), 1 + 8));
+    }
+
+    // Moving a vertex of a measured curve
+    {
+        Curve curve{Point(0, 0), Point(1, 0), Point(2, 0)};
+        CHECK(near(curve.getLength(), 2));
+
+        curve.getVertex(2).setCoords(Point(1, 5));
+
+        CHECK(near(curve.getLength(), 6));
+        CHECK(near(curve[1].y, 5));
+    }
+
+    // A control point beyond the end of the chord, the curve going further than its end point
+    {
+        Curve curve = Curve::adaptiveBezier({Point(0, 0), Point(10, 0), Point(1, 0)}, 0.25);
+        double reach = 0;
+
+        for( size_t k(0); k < curve.getVerticesCount(); k++ )
+            reach = std::max(reach, curve.getVertex(k).getCoords().x);
+
+        CHECK(curve.getLiaisonsCount() > 1);
+        CHECK(reach > 5.26 - 0.25);
+    }
+
+    // Projecting on a curve whose liaisons tree is refitted after a move
+    {
+        Curve curve{Point(0, 0), Point(1, 0), Point(2, 0), Point(3, 0)};
+        CHECK(near(curve.project(Point(1.5, 1)).distance, 1));
+
+        curve.getVertex(3).setCoords(Point(2, 10));
+        Curve::Projection projection = curve.project(Point(3, 5));
+
+        CHECK(near(projection.distance, 1));
+        CHECK(near(projection.point.y, 5));
+        CHECK(near(projection.length, 2 + 5));
+    }
+
+    return EXIT_SUCCESS;
+}
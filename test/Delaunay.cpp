@@ -0,0 +1,330 @@
+////////////////////////////////////////////////////////////
+//
+// Zoost C++ library
+// Copyright (C) 2011-2012 Pierre-Emmanuel BRIAN (zinlibs@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#include <Zoost/Delaunay.hpp>
+#include <Zoost/Geom.hpp>
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+#include "Check.hpp"
+
+using namespace zin;
+
+////////////////////////////////////////////////////////////
+// Twice the signed area of a triangle, positive if counterclockwise
+////////////////////////////////////////////////////////////
+double area(const Point& point1, const Point& point2, const Point& point3)
+{
+    return (point2.x - point1.x) * (point3.y - point1.y) - (point2.y - point1.y) * (point3.x - point1.x);
+}
+
+////////////////////////////////////////////////////////////
+// Positive if the point lies inside the circle of a triangle, whatever its orientation
+////////////////////////////////////////////////////////////
+double inCircle(const Point& point1, const Point& point2, const Point& point3, const Point& point)
+{
+    double x1 = point1.x - point.x, y1 = point1.y - point.y;
+    double x2 = point2.x - point.x, y2 = point2.y - point.y;
+    double x3 = point3.x - point.x, y3 = point3.y - point.y;
+
+    double determinant = (x1 * x1 + y1 * y1) * (x2 * y3 - x3 * y2) -
+                         (x2 * x2 + y2 * y2) * (x1 * y3 - x3 * y1) +
+                         (x3 * x3 + y3 * y3) * (x1 * y2 - x2 * y1);
+
+    return area(point1, point2, point3) > 0 ? determinant : -determinant;
+}
+
+////////////////////////////////////////////////////////////
+// Area of the convex hull of points, by the monotone chain
+////////////////////////////////////////////////////////////
+double hullArea(std::vector<Point> points)
+{
+    std::sort(points.begin(), points.end(), [](const Point& point1, const Point& point2)
+    {
+        return point1.x < point2.x || (point1.x == point2.x && point1.y < point2.y);
+    });
+
+    std::vector<Point> hull(points.size() * 2);
+    size_t count(0);
+
+    for( size_t k(0); k < points.size(); k++ )
+    {
+        while( count >= 2 && area(hull[count - 2], hull[count - 1], points[k]) <= 0 )
+            count--;
+
+        hull[count++] = points[k];
+    }
+
+    for( size_t k(points.size() - 1), lower(count + 1); k > 0; k-- )
+    {
+        while( count >= lower && area(hull[count - 2], hull[count - 1], points[k - 1]) <= 0 )
+            count--;
+
+        hull[count++] = points[k - 1];
+    }
+
+    double result(0);
+
+    for( size_t k(1); k + 1 < count; k++ )
+        result += area(hull[0], hull[k], hull[k + 1]);
+
+    return result / 2;
+}
+
+////////////////////////////////////////////////////////////
+// Total area of the triangles
+////////////////////////////////////////////////////////////
+double trianglesArea(const std::vector<Point>& points, const std::vector<size_t>& triangles)
+{
+    double result(0);
+
+    for( size_t k(0); k < triangles.size(); k+=3 )
+        result += std::fabs(area(points[triangles[k]], points[triangles[k + 1]], points[triangles[k + 2]]));
+
+    return result / 2;
+}
+
+////////////////////////////////////////////////////////////
+// Edge between two point indices, whatever their order
+////////////////////////////////////////////////////////////
+typedef std::pair<size_t, size_t> Edge;
+
+Edge makeEdge(size_t point1, size_t point2)
+{
+    return Edge(std::min(point1, point2), std::max(point1, point2));
+}
+
+////////////////////////////////////////////////////////////
+// Points facing each edge, one per triangle having it
+////////////////////////////////////////////////////////////
+std::map<Edge, std::vector<size_t>> getOpposites(const std::vector<size_t>& triangles)
+{
+    std::map<Edge, std::vector<size_t>> opposites;
+
+    for( size_t k(0); k < triangles.size(); k+=3 )
+    {
+        for( size_t i(0); i < 3; i++ )
+            opposites[makeEdge(triangles[k + i], triangles[k + (i + 1) % 3])].push_back(triangles[k + (i + 2) % 3]);
+    }
+
+    return opposites;
+}
+
+////////////////////////////////////////////////////////////
+// Check if every interior edge but the forced ones is locally Delaunay
+////////////////////////////////////////////////////////////
+bool isDelaunay(const std::vector<Point>& points, const std::vector<size_t>& triangles, const std::vector<Edge>& forced)
+{
+    auto opposites = getOpposites(triangles);
+
+    for( auto& opposite : opposites )
+    {
+        const Edge& edge = opposite.first;
+
+        if( opposite.second.size() != 2 || std::find(forced.begin(), forced.end(), edge) != forced.end() )
+            continue;
+
+        const Point& point1 = points[edge.first];
+        const Point& point2 = points[edge.second];
+        const Point& point3 = points[opposite.second[0]];
+
+        if( inCircle(point1, point2, point3, points[opposite.second[1]]) > 1e-6 )
+            return false;
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////
+// Check if two segments cross, touching by their ends being allowed
+////////////////////////////////////////////////////////////
+bool cross(const Point& point1, const Point& point2, const Point& point3, const Point& point4)
+{
+    return area(point1, point2, point3) * area(point1, point2, point4) < 0 &&
+           area(point3, point4, point1) * area(point3, point4, point2) < 0;
+}
+
+////////////////////////////////////////////////////////////
+// Points of a few shapes of sets
+////////////////////////////////////////////////////////////
+std::vector<Point> makePoints(size_t shape, std::mt19937& random)
+{
+    std::uniform_real_distribution<double> uniform(0, 100);
+    std::normal_distribution<double> normal(0, 1);
+    std::vector<Point> points;
+
+    switch( shape )
+    {
+        case 0 :
+            for( size_t k(0); k < 500; k++ )
+                points.push_back(Point(uniform(random), uniform(random)));
+            break;
+
+        case 1 :
+            for( size_t x(0); x < 20; x++ )
+            {
+                for( size_t y(0); y < 20; y++ )
+                    points.push_back(Point(x, y));
+            }
+            break;
+
+        case 2 :
+            for( size_t cluster(0); cluster < 5; cluster++ )
+            {
+                Point center(uniform(random), uniform(random));
+
+                for( size_t k(0); k < 100; k++ )
+                    points.push_back(Point(center.x + normal(random), center.y + normal(random)));
+            }
+            break;
+
+        default :
+            for( size_t k(0); k < 500; k++ )
+            {
+                double scale = std::pow(10, k % 4);
+                points.push_back(Point(uniform(random) * scale, uniform(random) * scale));
+            }
+            break;
+    }
+
+    return points;
+}
+
+////////////////////////////////////////////////////////////
+int main()
+{
+    std::mt19937 random(42);
+
+    // Triangulating, the hull being covered by locally Delaunay triangles
+    for( size_t shape(0); shape < 4; shape++ )
+    {
+        std::vector<Point> points = makePoints(shape, random);
+        std::vector<size_t> triangles;
+
+        Delaunay delaunay;
+        delaunay.triangulate(points.data(), points.size());
+        delaunay.getTriangles(triangles);
+
+        CHECK(isDelaunay(points, triangles, std::vector<Edge>()));
+
+        double hull = hullArea(points);
+        CHECK(std::fabs(trianglesArea(points, triangles) - hull) < hull * 1e-9);
+    }
+
+    // Forcing edges, the ones crossing an earlier one being refused
+    for( size_t round(0); round < 20; round++ )
+    {
+        std::vector<Point> points = makePoints(0, random);
+        std::vector<Edge> forced;
+
+        Delaunay delaunay;
+        delaunay.triangulate(points.data(), points.size());
+
+        for( size_t k(0); k < 30; k++ )
+        {
+            Edge edge = makeEdge(random() % points.size(), random() % points.size());
+
+            if( edge.first == edge.second )
+                continue;
+
+            bool crossing(false);
+
+            for( auto& other : forced )
+            {
+                if( cross(points[edge.first], points[edge.second], points[other.first], points[other.second]) )
+                    crossing = true;
+            }
+
+            CHECK(delaunay.constrain(edge.first, edge.second) == !crossing);
+
+            if( !crossing )
+                forced.push_back(edge);
+        }
+
+        std::vector<size_t> triangles;
+        delaunay.getTriangles(triangles);
+
+        auto opposites = getOpposites(triangles);
+
+        for( auto& edge : forced )
+            CHECK(opposites.count(edge) == 1);
+
+        CHECK(isDelaunay(points, triangles, forced));
+
+        double hull = hullArea(points);
+        CHECK(std::fabs(trianglesArea(points, triangles) - hull) < hull * 1e-9);
+    }
+
+    // Carving a square hole in a square
+    {
+        std::vector<Point> points{Point(0, 0), Point(10, 0), Point(10, 10), Point(0, 10),
+                                  Point(4, 4), Point(6, 4), Point(6, 6), Point(4, 6), Point(1, 8)};
+
+        Delaunay delaunay;
+        delaunay.triangulate(points.data(), points.size());
+
+        for( size_t k(0); k < 4; k++ )
+        {
+            CHECK(delaunay.constrain(k, (k + 1) % 4));
+            CHECK(delaunay.constrain(4 + k, 4 + (k + 1) % 4));
+        }
+
+        std::vector<size_t> triangles;
+        delaunay.getTriangles(triangles, true);
+
+        CHECK(std::fabs(trianglesArea(points, triangles) - 96) < 1e-9);
+    }
+
+    // Triangulating a geom, its faces being kept when its outline crosses itself
+    {
+        Geom geom;
+        geom.addVertex(Coords(0, 0));
+        geom.addVertex(Coords(10, 0));
+        geom.addVertex(Coords(0, 10));
+        geom.addVertex(Coords(10, 10));
+
+        for( size_t k(0); k < 4; k++ )
+            geom.addLiaison(geom.getVertex(k), geom.getVertex((k + 1) % 4));
+
+        geom.addFace(geom.getVertex(0), geom.getVertex(1), geom.getVertex(2));
+
+        CHECK(!geom.triangulate());
+        CHECK(geom.getFacesCount() == 1);
+
+        geom.removeLiaisons({0, 1, 2, 3});
+
+        const size_t square[] = {0, 1, 3, 2};
+
+        for( size_t k(0); k < 4; k++ )
+            geom.addLiaison(geom.getVertex(square[k]), geom.getVertex(square[(k + 1) % 4]));
+
+        CHECK(geom.triangulate());
+        CHECK(geom.getFacesCount() == 2);
+    }
+
+    return EXIT_SUCCESS;
+}
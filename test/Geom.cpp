@@ -0,0 +1,175 @@
+////////////////////////////////////////////////////////////
+//
+// Zoost C++ library
+// Copyright (C) 2011-2012 Pierre-Emmanuel BRIAN (zinlibs@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#include <Zoost/Geom.hpp>
+#include <random>
+#include <vector>
+#include "Check.hpp"
+
+using namespace zin;
+
+////////////////////////////////////////////////////////////
+// Elements of a geom, as indices and coordinates
+////////////////////////////////////////////////////////////
+struct Snapshot
+{
+    std::vector<Coords>              vertices;
+    std::vector<std::vector<size_t>> liaisons;
+    std::vector<std::vector<size_t>> faces;
+
+    Snapshot(const Geom& geom)
+    {
+        for( size_t k(0); k < geom.getVerticesCount(); k++ )
+            vertices.push_back(geom.getVertex(k).getCoords());
+
+        for( size_t k(0); k < geom.getLiaisonsCount(); k++ )
+        {
+            const Liaison& liaison = geom.getLiaison(k);
+            liaisons.push_back({liaison.v1.getIndice(), liaison.v2.getIndice()});
+        }
+
+        for( size_t k(0); k < geom.getFacesCount(); k++ )
+        {
+            const Face& face = geom.getFace(k);
+            faces.push_back({face.v1.getIndice(), face.v2.getIndice(), face.v3.getIndice()});
+        }
+    }
+};
+
+////////////////////////////////////////////////////////////
+// Observer keeping the last changes reported
+////////////////////////////////////////////////////////////
+class Recorder : public Geom::Observer
+{
+public:
+
+    Geom::Changes changes;
+    size_t        edits = 0;
+
+private:
+
+    void onEdited(const Geom::Changes& changes)
+    {
+        this->changes = changes;
+        edits++;
+    }
+};
+
+////////////////////////////////////////////////////////////
+// Check if the elements left out of a range are the same before and after
+////////////////////////////////////////////////////////////
+template <typename T>
+bool unchanged(const std::vector<T>& before, const std::vector<T>& after, const Geom::Range& range)
+{
+    for( size_t k(0); k < std::min(before.size(), after.size()); k++ )
+    {
+        if( (k < range.begin || k >= range.end) && !(before[k] == after[k]) )
+            return false;
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////
+bool unchanged(const Snapshot& before, const Snapshot& after, const Geom::Changes& changes)
+{
+    return unchanged(before.vertices, after.vertices, changes.vertices) &&
+           unchanged(before.liaisons, after.liaisons, changes.liaisons) &&
+           unchanged(before.faces, after.faces, changes.faces);
+}
+
+////////////////////////////////////////////////////////////
+int main()
+{
+    // Removing a vertex in an edit, the liaison and the face kept being renumbered
+    {
+        Geom geom;
+        Recorder recorder;
+
+        for( size_t k(0); k < 4; k++ )
+            geom.addVertex(Coords(k, k * k));
+
+        geom.addFace(geom.getVertex(1), geom.getVertex(2), geom.getVertex(3));
+        geom.addLiaison(geom.getVertex(2), geom.getVertex(3));
+        geom.addObserver(recorder);
+
+        Snapshot before(geom);
+
+        {
+            Geom::Edit edit(geom);
+            geom.removeVertex(geom.getVertex(0));
+        }
+
+        CHECK(recorder.edits == 1);
+        CHECK(geom.getLiaison(0).v1.getIndice() == 1);
+        CHECK(geom.getFace(0).v1.getIndice() == 0);
+        CHECK(recorder.changes.liaisons.begin == 0 && recorder.changes.liaisons.end == 1);
+        CHECK(recorder.changes.faces.begin == 0 && recorder.changes.faces.end == 1);
+        CHECK(unchanged(before, Snapshot(geom), recorder.changes));
+    }
+
+    // Removing random elements in edits, compared to snapshots
+    {
+        std::mt19937 random(42);
+
+        for( size_t round(0); round < 500; round++ )
+        {
+            Geom geom;
+            Recorder recorder;
+            size_t count = 4 + random() % 12;
+
+            for( size_t k(0); k < count; k++ )
+                geom.addVertex(Coords(random() % 100, random() % 100));
+
+            for( size_t k(0); k < count; k++ )
+                geom.addLiaison(geom.getVertex(random() % count), geom.getVertex(random() % count));
+
+            for( size_t k(0); k < count; k++ )
+                geom.addFace(geom.getVertex(random() % count), geom.getVertex(random() % count), geom.getVertex(random() % count));
+
+            geom.addObserver(recorder);
+
+            Snapshot before(geom);
+
+            {
+                Geom::Edit edit(geom);
+
+                for( size_t k(random() % 3 + 1); k > 0 && geom.getVerticesCount() > 0; k-- )
+                {
+                    switch( random() % 3 )
+                    {
+                        case 0 : geom.removeVertex(geom.getVertex(random() % geom.getVerticesCount())); break;
+                        case 1 : if( geom.getLiaisonsCount() > 0 ) geom.removeLiaison(geom.getLiaison(random() % geom.getLiaisonsCount())); break;
+                        case 2 : if( geom.getFacesCount() > 0 ) geom.removeFace(geom.getFace(random() % geom.getFacesCount())); break;
+                    }
+                }
+            }
+
+            if( recorder.edits > 0 )
+                CHECK(unchanged(before, Snapshot(geom), recorder.changes));
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
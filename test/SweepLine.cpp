@@ -0,0 +1,160 @@
+////////////////////////////////////////////////////////////
+//
+// Zoost C++ library
+// Copyright (C) 2011-2012 Pierre-Emmanuel BRIAN (zinlibs@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#include <Zoost/SweepLine.hpp>
+#include <Zoost/Geom.hpp>
+#include <algorithm>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+#include "Check.hpp"
+
+using namespace zin;
+
+////////////////////////////////////////////////////////////
+// Twice the signed area of a triangle, positive if counterclockwise
+////////////////////////////////////////////////////////////
+double area(const Point& point1, const Point& point2, const Point& point3)
+{
+    return (point2.x - point1.x) * (point3.y - point1.y) - (point2.y - point1.y) * (point3.x - point1.x);
+}
+
+////////////////////////////////////////////////////////////
+// Check if a point aligned with a segment lies within its bounds
+////////////////////////////////////////////////////////////
+bool within(const Segment& segment, const Point& point)
+{
+    return std::min(segment.p1.x, segment.p2.x) <= point.x && point.x <= std::max(segment.p1.x, segment.p2.x) &&
+           std::min(segment.p1.y, segment.p2.y) <= point.y && point.y <= std::max(segment.p1.y, segment.p2.y);
+}
+
+////////////////////////////////////////////////////////////
+// Check if two segments have a point in common
+////////////////////////////////////////////////////////////
+bool meet(const Segment& s1, const Segment& s2)
+{
+    double a1 = area(s1.p1, s1.p2, s2.p1), a2 = area(s1.p1, s1.p2, s2.p2),
+           a3 = area(s2.p1, s2.p2, s1.p1), a4 = area(s2.p1, s2.p2, s1.p2);
+
+    if( ((a1 > 0 && a2 < 0) || (a1 < 0 && a2 > 0)) && ((a3 > 0 && a4 < 0) || (a3 < 0 && a4 > 0)) )
+        return true;
+
+    return (a1 == 0 && within(s1, s2.p1)) || (a2 == 0 && within(s1, s2.p2)) ||
+           (a3 == 0 && within(s2, s1.p1)) || (a4 == 0 && within(s2, s1.p2));
+}
+
+////////////////////////////////////////////////////////////
+// Pairs of segments reported by the sweep
+////////////////////////////////////////////////////////////
+std::set<std::pair<size_t, size_t>> sweep(const std::vector<Segment>& segments)
+{
+    std::vector<SweepLine::Crossing> crossings;
+    SweepLine::compute(segments, crossings);
+
+    std::set<std::pair<size_t, size_t>> pairs;
+
+    for( auto& crossing : crossings )
+        pairs.insert(std::make_pair(crossing.segment1, crossing.segment2));
+
+    return pairs;
+}
+
+////////////////////////////////////////////////////////////
+// Pairs of segments meeting, by testing them all
+////////////////////////////////////////////////////////////
+std::set<std::pair<size_t, size_t>> bruteForce(const std::vector<Segment>& segments)
+{
+    std::set<std::pair<size_t, size_t>> pairs;
+
+    for( size_t i(0); i < segments.size(); i++ )
+    {
+        for( size_t j(i + 1); j < segments.size(); j++ )
+        {
+            if( meet(segments[i], segments[j]) )
+                pairs.insert(std::make_pair(i, j));
+        }
+    }
+
+    return pairs;
+}
+
+////////////////////////////////////////////////////////////
+// Make a polyline of liaisons through points, back to the first one if closed
+////////////////////////////////////////////////////////////
+Geom makePolyline(const std::vector<Coords>& points, bool closed = false)
+{
+    Geom geom;
+
+    for( auto& point : points )
+        geom.addVertex(point);
+
+    for( size_t k(1); k < points.size(); k++ )
+        geom.addLiaison(geom.getVertex(k - 1), geom.getVertex(k));
+
+    if( closed )
+        geom.addLiaison(geom.getVertex(points.size() - 1), geom.getVertex(0));
+
+    return geom;
+}
+
+////////////////////////////////////////////////////////////
+int main()
+{
+    std::mt19937 random(42);
+
+    // Crossing random segments, in general position or on a small grid with shared ends & overlaps
+    for( size_t round(0); round < 200; round++ )
+    {
+        std::uniform_real_distribution<double> uniform(0, 100);
+        std::vector<Segment> segments;
+        bool grid = round % 2 == 1;
+
+        for( size_t k(0); k < 40; k++ )
+        {
+            if( grid )
+                segments.push_back(Segment(Point(random() % 8, random() % 8), Point(random() % 8, random() % 8)));
+
+            else
+                segments.push_back(Segment(Point(uniform(random), uniform(random)), Point(uniform(random), uniform(random))));
+
+            if( segments.back().p1 == segments.back().p2 )
+                segments.pop_back();
+        }
+
+        CHECK(sweep(segments) == bruteForce(segments));
+    }
+
+    // Validating polylines, adjacent liaisons only counting when they overlap
+    {
+        CHECK(!makePolyline({Coords(0, 0), Coords(2, 0), Coords(2, 2)}).selfIntersects());
+        CHECK(!makePolyline({Coords(0, 0), Coords(2, 0), Coords(4, 0)}).selfIntersects());
+        CHECK(!makePolyline({Coords(0, 0), Coords(2, 0), Coords(2, 2), Coords(0, 2)}, true).selfIntersects());
+        CHECK(makePolyline({Coords(0, 0), Coords(2, 0), Coords(1, 0)}).selfIntersects());
+        CHECK(makePolyline({Coords(2, 0), Coords(0, 0), Coords(1, 0)}).selfIntersects());
+        CHECK(makePolyline({Coords(0, 0), Coords(2, 2), Coords(2, 0), Coords(0, 2)}).selfIntersects());
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,149 @@
+////////////////////////////////////////////////////////////
+//
+// Zoost C++ library
+// Copyright (C) 2011-2012 Pierre-Emmanuel BRIAN (zinlibs@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#include <Zoost/Topology.hpp>
+#include <Zoost/Geom.hpp>
+#include <algorithm>
+#include <vector>
+#include "Check.hpp"
+
+using namespace zin;
+
+////////////////////////////////////////////////////////////
+// Get a row sorted, the rows order being left free
+////////////////////////////////////////////////////////////
+std::vector<size_t> sorted(const Topology::Indices& indices)
+{
+    std::vector<size_t> row(indices.begin(), indices.end());
+    std::sort(row.begin(), row.end());
+
+    return row;
+}
+
+////////////////////////////////////////////////////////////
+// Check if two topologies of the same geom hold the same rows
+////////////////////////////////////////////////////////////
+bool same(const Topology& topology1, const Topology& topology2)
+{
+    for( size_t k(0); k < topology1.getGeom().getVerticesCount(); k++ )
+    {
+        if( sorted(topology1.getNeighbours(k)) != sorted(topology2.getNeighbours(k)) ||
+            sorted(topology1.getLiaisons(k)) != sorted(topology2.getLiaisons(k)) ||
+            sorted(topology1.getFaces(k)) != sorted(topology2.getFaces(k)) )
+            return false;
+    }
+
+    return topology1.getBoundaries() == topology2.getBoundaries();
+}
+
+////////////////////////////////////////////////////////////
+// Add a strip of quads, two faces each, bordered by liaisons
+////////////////////////////////////////////////////////////
+void addStrip(Geom& geom, size_t count)
+{
+    size_t offset = geom.getVerticesCount();
+
+    for( size_t k(0); k <= count; k++ )
+    {
+        geom.addVertex(Point(double(k), 0));
+        geom.addVertex(Point(double(k), 1));
+    }
+
+    for( size_t k(0); k < count; k++ )
+    {
+        const Vertex& v1 = geom.getVertex(offset + 2 * k);
+        const Vertex& v2 = geom.getVertex(offset + 2 * k + 2);
+        const Vertex& v3 = geom.getVertex(offset + 2 * k + 3);
+        const Vertex& v4 = geom.getVertex(offset + 2 * k + 1);
+
+        geom.addFace(v1, v2, v3);
+        geom.addFace(v1, v3, v4);
+        geom.addLiaison(v1, v2);
+        geom.addLiaison(v4, v3);
+    }
+}
+
+////////////////////////////////////////////////////////////
+int main()
+{
+    // A copy of an observed geom is not observed by the topology
+    {
+        Geom geom;
+        addStrip(geom, 3);
+
+        Geom* copy;
+
+        {
+            Topology topology(geom);
+            CHECK(topology.getNeighbours(0).size() == 3);
+
+            copy = new Geom(geom);
+        }
+
+        copy->addVertex(Point(5, 5));
+        copy->getVertex(0).setCoords(Point(-1, 0));
+        copy->removeVertex(copy->getVertex(1));
+        delete copy;
+
+        Topology topology(geom);
+        Geom other;
+        other = geom;
+        other.addVertex(Point(5, 5));
+
+        CHECK(topology.getGeom().getVerticesCount() == 8);
+        CHECK(topology.getBoundaries().size() == 1);
+        CHECK(topology.getBoundaries()[0].size() == 8);
+    }
+
+    // The tables grown along the additions match the rebuilt ones
+    {
+        Geom geom;
+        Topology topology(geom);
+
+        for( size_t k(0); k < 20; k++ )
+        {
+            addStrip(geom, k % 4 + 1);
+            geom.addLiaison(geom.getVertex(0), geom.getVertex(geom.getVerticesCount() - 1));
+
+            Topology rebuilt(geom);
+            CHECK(same(topology, rebuilt));
+        }
+
+        {
+            Geom::Edit edit(geom);
+            addStrip(geom, 5);
+        }
+
+        Topology rebuilt(geom);
+        CHECK(same(topology, rebuilt));
+
+        geom.removeFace(geom.getFace(3));
+        geom.addFace(geom.getVertex(0), geom.getVertex(2), geom.getVertex(3));
+
+        Topology removed(geom);
+        CHECK(same(topology, removed));
+    }
+
+    return EXIT_SUCCESS;
+}